@@ -539,6 +539,18 @@ public:
    */
   bool all_semilocal_indices (const std::vector<dof_id_type>& dof_indices) const;
 
+  /**
+   * Splits the active local elements of \p mesh into colors, such
+   * that no two elements of the same color share a degree of freedom
+   * (including degrees of freedom coupled through constraints).  The
+   * elements of each color then have disjoint contributions to the
+   * global system.  Elements are colored greedily in iteration
+   * order, so earlier colors are larger.
+   */
+  void color_active_local_elements
+  (const MeshBase& mesh,
+   std::vector<std::vector<const Elem*> >& colors) const;
+
   /**
    * Allow the implicit_neighbor_dofs flag to be set programmatically.
    * This overrides the --implicit_neighbor_dofs commandline option.
@@ -26,6 +26,7 @@
 #include "libmesh/libmesh_common.h"
 #include "libmesh/libmesh.h" // libMesh::invalid_uint
 #include "libmesh/reference_counted_object.h"
+#include "libmesh/small_vector.h"
 
 // C++ includes
 #include <cstddef>
@@ -458,9 +459,15 @@ private:
    * *within the system*. So for a system with 2 variable groups, 4 and 8 variables each,
    * the 5th variable in the system is the 1st variable in 2nd variable group.
    * (Now of course 0-base everything...  but you get the idea.)
+   *
+   * The buffer is stored inline in the \p DofObject as long as it has
+   * no more than \p idx_buf_inline_size entries, which covers e.g. two
+   * systems with one variable group each, and only spills to the heap
+   * for larger indexings.
    */
   typedef dof_id_type index_t;
-  typedef std::vector<index_t> index_buffer_t;
+  static const unsigned int idx_buf_inline_size = 6;
+  typedef small_vector<index_t, idx_buf_inline_size> index_buffer_t;
   index_buffer_t _idx_buf;
 
   /**
@@ -488,7 +495,7 @@ private:
 #ifdef LIBMESH_IS_UNIT_TESTING
 public:
   void set_buffer (const std::vector<dof_id_type> &buf)
-  { _idx_buf = buf; }
+  { _idx_buf.assign(buf.begin(), buf.end()); }
 #endif
 };
 
@@ -575,7 +582,7 @@ void DofObject::invalidate ()
 inline
 void DofObject::clear_dofs ()
 {
-  // vector swap trick to force deallocation
+  // swap with an empty buffer to force deallocation
   index_buffer_t().swap(_idx_buf);
 
   libmesh_assert_equal_to (this->n_systems(), 0);
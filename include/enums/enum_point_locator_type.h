@@ -33,6 +33,7 @@ enum PointLocatorType {TREE = 0,
                        TREE_ELEMENTS,
                        TREE_LOCAL_ELEMENTS,
                        LIST,
+                       BVH,
                        INVALID_LOCATOR};
 }
 
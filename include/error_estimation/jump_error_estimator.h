@@ -23,12 +23,16 @@
 // Local Includes
 #include "libmesh/auto_ptr.h"
 #include "libmesh/dense_vector.h"
+#include "libmesh/elem_range.h"
 #include "libmesh/error_estimator.h"
 #include "libmesh/fe_base.h"
+#include "libmesh/quadrature.h"
+#include "libmesh/threads.h"
 
 // C++ includes
 #include <cstddef>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace libMesh
@@ -46,6 +50,10 @@ class Elem;
  * This abstract base class implements utility functions for error estimators
  * which are based on integrated jumps between elements.
  *
+ * The side integrations are threaded over the active local elements
+ * whenever the derived class implements clone(); the result does not
+ * depend on the number of threads used.
+ *
  * @author Roy H. Stogner, 2006
  */
 class JumpErrorEstimator : public ErrorEstimator
@@ -63,7 +71,8 @@ public:
       fine_error(0), coarse_error(0),
       fine_side(libMesh::invalid_uint),
       var(libMesh::invalid_uint),
-      fe_fine(NULL), fe_coarse(NULL) {}
+      fe_fine(NULL), fe_coarse(NULL),
+      _qrule(NULL) {}
 
   /**
    * Destructor.
@@ -93,6 +102,14 @@ public:
   bool scale_by_n_flux_faces;
 
 protected:
+  /**
+   * Returns a new estimator of the same type and with the same
+   * settings as this one, to be used as per-thread workspace by
+   * estimate_error().  The default implementation returns a NULL
+   * AutoPtr, in which case estimate_error() runs on a single thread.
+   */
+  virtual AutoPtr<JumpErrorEstimator> clone() const;
+
   /**
    * A utility function to reinit the finite element data on elements sharing a
    * side
@@ -160,6 +177,90 @@ protected:
    * The finite element objects for fine and coarse elements
    */
   AutoPtr<FEBase> fe_fine, fe_coarse;
+
+private:
+
+  /**
+   * Builds the finite element objects and quadrature rule for
+   * the current \p var and calls initialize().
+   */
+  void init_fe (const System& system,
+                ErrorVector& error_per_cell,
+                bool estimate_parent_error);
+
+  /**
+   * The side quadrature rule attached to \p fe_fine
+   */
+  AutoPtr<QBase> _qrule;
+
+  /**
+   * Class to compute the side integrations for one variable on a
+   * range of active local elements.  Split copies work on clones of
+   * the estimator.  The error contributions are recorded rather than
+   * summed, so that they can be added to the error vector in element
+   * order once all threads are done.
+   */
+  class EstimateError
+  {
+  public:
+    EstimateError (const System& sys,
+                   JumpErrorEstimator& ee,
+                   const ErrorVector& epc,
+                   bool estimate_parent_error) :
+      system(sys),
+      _clone(NULL),
+      error_estimator(ee),
+      error_per_cell(epc),
+      _estimate_parent_error(estimate_parent_error),
+      _error_sum(NULL),
+      _n_flux_faces_sum(NULL)
+    {}
+
+    EstimateError (EstimateError& other, Threads::split);
+
+    void operator()(const ConstElemRange& range);
+
+    void join (const EstimateError& other);
+
+    /**
+     * Sum contributions directly into \p error_sum and \p
+     * n_flux_faces_sum instead of recording them.  Only valid for a
+     * body which is never split.
+     */
+    void accumulate_into (ErrorVector& error_sum,
+                          std::vector<float>& n_flux_faces_sum)
+    { _error_sum = &error_sum; _n_flux_faces_sum = &n_flux_faces_sum; }
+
+    /**
+     * A single error and flux face contribution to an element.
+     */
+    struct Contribution
+    {
+      dof_id_type elem_id;
+      Real error;
+      float n_flux_faces;
+    };
+
+    /**
+     * The contributions computed on each subrange, keyed by the
+     * index of the first element of that subrange.
+     */
+    std::vector<std::pair<std::size_t, std::vector<Contribution> > > contributions;
+
+  private:
+
+    void add_contribution (const Elem* elem, Real error, float n_flux_faces);
+
+    const System& system;
+    AutoPtr<JumpErrorEstimator> _clone;
+    JumpErrorEstimator& error_estimator;
+    const ErrorVector& error_per_cell;
+    const bool _estimate_parent_error;
+    ErrorVector* _error_sum;
+    std::vector<float>* _n_flux_faces_sum;
+  };
+
+  friend class EstimateError;
 };
 
 
@@ -88,6 +88,11 @@ public:
 
 protected:
 
+  /**
+   * Returns a copy of this estimator, for use by other threads.
+   */
+  virtual AutoPtr<JumpErrorEstimator> clone() const;
+
   /**
    * An initialization function, for requesting specific data from the FE
    * objects
@@ -22,6 +22,7 @@
 
 // Local includes
 #include "libmesh/fe_base.h"
+#include "libmesh/elem.h"
 #include "libmesh/libmesh.h"
 
 // C++ includes
@@ -478,6 +479,15 @@ protected:
   ElemType last_side;
 
   unsigned int last_edge;
+
+  /**
+   * The side and edge elements built by the last side and edge
+   * reinits.  Their storage is reused by the next reinit, so that
+   * side loops do not allocate a new element for every side.
+   */
+  AutoPtr<Elem> cached_side;
+
+  AutoPtr<Elem> cached_edge;
 };
 
 
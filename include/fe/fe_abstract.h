@@ -194,6 +194,14 @@ public:
   static void get_refspace_nodes(const ElemType t,
                                  std::vector<Point>& nodes);
 
+  /**
+   * Frees the derivatives of the reference shape functions which FE
+   * objects share between them.  They are computed again when next
+   * needed.  Must not be called while any FE object is being
+   * reinitialized.  Called by the \p LibMeshInit destructor.
+   */
+  static void clear_reference_shapes ();
+
 
 #ifdef LIBMESH_ENABLE_NODE_CONSTRAINTS
   /**
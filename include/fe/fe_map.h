@@ -43,6 +43,25 @@ public:
 
   static AutoPtr<FEMap> build(FEType fe_type);
 
+  /**
+   * Returns counts of the map inversions done by \p FE::inverse_map()
+   * since the start of the program or the last call to
+   * \p clear_inverse_map_statistics(): the number of points mapped,
+   * how many of those were on elements with affine maps, which take
+   * a single Newton step, and the total number of Newton steps.  The
+   * counts are only kept when libMesh is configured with
+   * --enable-perflog, and are zero otherwise.
+   */
+  static void inverse_map_statistics (unsigned long int& n_points,
+                                      unsigned long int& n_affine_points,
+                                      unsigned long int& n_iterations);
+
+  /**
+   * Resets the counts returned by \p inverse_map_statistics().  Not
+   * to be called while other threads may be inverting maps.
+   */
+  static void clear_inverse_map_statistics ();
+
   template<unsigned int Dim>
   void init_reference_to_physical_map(const std::vector<Point>& qp,
                                       const Elem* elem);
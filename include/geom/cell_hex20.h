@@ -143,6 +143,22 @@ public:
    */
   AutoPtr<Elem> build_edge (const unsigned int i) const;
 
+  /**
+   * Rebuilds \p side as the full-ordered element coincident with
+   * side \p i, reusing its storage when possible.
+   */
+  virtual void build_side_ptr (AutoPtr<Elem>& side,
+                               const unsigned int i) const
+  { this->simple_build_side_ptr<Hex20>(side, i, QUAD8); }
+
+  /**
+   * Rebuilds \p edge as the EDGE3 coincident with edge \p i,
+   * reusing its storage when possible.
+   */
+  virtual void build_edge_ptr (AutoPtr<Elem>& edge,
+                               const unsigned int i) const
+  { this->simple_build_edge_ptr<Hex20>(edge, i, EDGE3); }
+
   virtual void connectivity(const unsigned int sc,
                             const IOPackage iop,
                             std::vector<dof_id_type>& conn) const;
@@ -100,6 +100,13 @@ public:
    */
   AutoPtr<Elem> side (const unsigned int i) const;
 
+  /**
+   * Rebuilds \p side as the primitive face coincident with side
+   * \p i, reusing its storage when possible.
+   */
+  virtual void side_ptr (AutoPtr<Elem>& side,
+                         const unsigned int i) const;
+
 
 protected:
 
@@ -141,6 +141,21 @@ public:
   AutoPtr<Elem> build_side (const unsigned int i,
                             bool proxy) const;
 
+  /**
+   * Rebuilds \p side as a NodeElem for the specified node,
+   * reusing its storage when possible.
+   */
+  virtual void side_ptr (AutoPtr<Elem>& side,
+                         const unsigned int i) const;
+
+  /**
+   * Sides of edges are always NodeElems, so this is
+   * the same as \p side_ptr().
+   */
+  virtual void build_side_ptr (AutoPtr<Elem>& side,
+                               const unsigned int i) const
+  { this->side_ptr(side, i); }
+
   /**
    * The \p Elem::build_edge() member makes no sense for edges.
    */
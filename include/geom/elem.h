@@ -34,6 +34,7 @@
 #include "libmesh/multi_predicates.h"
 #include "libmesh/variant_filter_iterator.h"
 #include "libmesh/hashword.h" // Used in compute_key() functions
+#include "libmesh/slab_allocator.h"
 
 // C++ includes
 #include <algorithm>
@@ -41,6 +42,7 @@
 #include <iostream>
 #include <limits.h> // CHAR_BIT
 #include <set>
+#include <utility>
 #include <vector>
 
 namespace libMesh
@@ -111,6 +113,19 @@ public:
    */
   virtual ~Elem();
 
+#ifdef LIBMESH_ENABLE_SLAB_ALLOCATOR
+  /**
+   * Elements are allocated from the slabs of the \p SlabAllocator,
+   * so that elements of the same type are packed together and
+   * creating or deleting an element does not call \p malloc.
+   */
+  static void* operator new (std::size_t size)
+  { return SlabAllocator::allocate(size); }
+
+  static void operator delete (void* p, std::size_t size)
+  { SlabAllocator::deallocate(p, size); }
+#endif
+
   /**
    * @returns the \p Point associated with local \p Node \p i.
    */
@@ -554,6 +569,34 @@ public:
    */
   virtual AutoPtr<Elem> build_edge (const unsigned int i) const = 0;
 
+  /**
+   * Resets \p side to an element coincident with side \p i, with the
+   * same vertices that \p side(i) would give.  If \p side already
+   * holds an element of the right type, that element is reused
+   * instead of allocating a new one, so a loop over many sides can
+   * hold a single \p AutoPtr<Elem> and avoid hitting the allocator
+   * for every side.  Like the \p Side proxies, the resulting element
+   * shares node pointers with this element and has this element as
+   * its \p parent(); it has no neighbors.  Element types which
+   * cannot reuse sides (e.g. infinite elements) simply store the
+   * result of \p side(i).
+   */
+  virtual void side_ptr (AutoPtr<Elem>& side, const unsigned int i) const;
+
+  /**
+   * Resets \p side to a full-ordered element coincident with side
+   * \p i, with the nodes \p build_side(i) would give, reusing the
+   * element already held in \p side when it has the right type.
+   */
+  virtual void build_side_ptr (AutoPtr<Elem>& side, const unsigned int i) const;
+
+  /**
+   * Resets \p edge to a full-ordered element coincident with edge
+   * \p i, as \p build_edge(i) would return, reusing the element
+   * already held in \p edge when it has the right type.
+   */
+  virtual void build_edge_ptr (AutoPtr<Elem>& edge, const unsigned int i) const;
+
   /**
    * @returns the default approximation order for this element type.
    * This is the order that will be used to compute the map to the
@@ -1020,6 +1063,18 @@ public:
    */
   virtual void refine (MeshRefinement& mesh_refinement);
 
+  /**
+   * Allocates the children of this element and computes the
+   * locations of their nodes, without adding anything to the mesh.
+   * Child nodes which coincide with a node of this element are
+   * returned in \p nodes, the others are left \p NULL and only
+   * their location is given in \p p.  Both are indexed by child and
+   * child node.  This is the part of refine() which may be done for
+   * several elements concurrently.
+   */
+  void build_children (std::vector<std::vector<Point> >& p,
+                       std::vector<std::vector<Node*> >& nodes);
+
   /**
    * Coarsen the element.  This is not
    * virtual since it is the same for all
@@ -1027,6 +1082,20 @@ public:
    */
   void coarsen ();
 
+  /**
+   * Coarsen the element, moving the hanging nodes of its children
+   * to the given \p node_locations, as computed by
+   * coarsened_node_locations().
+   */
+  void coarsen (const std::vector<std::pair<Node*, Point> >& node_locations);
+
+  /**
+   * Computes the locations coarsen() moves the hanging nodes of this
+   * element's children back to, without moving them.
+   */
+  void coarsened_node_locations
+  (std::vector<std::pair<Node*, Point> >& node_locations) const;
+
   /**
    * Contract an active element, i.e. remove pointers to any
    * subactive children.  This should only be called via
@@ -1171,6 +1240,35 @@ protected:
                                   dof_id_type n3);
   //-------------------------------------------------------
 
+  /**
+   * Makes \p side hold an element of type \p type whose parent is
+   * this element, as with the \p Side proxies, reusing the element
+   * already held in \p side when it has that type.  Its nodes are
+   * left for the caller to set.
+   */
+  void prepare_side_ptr (AutoPtr<Elem>& side,
+                         const ElemType type) const;
+
+  /**
+   * Implements \p side_ptr and \p build_side_ptr for element
+   * classes which provide a \p side_nodes_map.  The side is
+   * (re)built as an element of type \p sidetype whose nodes are
+   * \p Subclass::side_nodes_map[i][0..n_nodes).
+   */
+  template <typename Subclass>
+  void simple_build_side_ptr (AutoPtr<Elem>& side,
+                              const unsigned int i,
+                              const ElemType sidetype) const;
+
+  /**
+   * Implements \p build_edge_ptr for element classes which provide
+   * an \p edge_nodes_map.
+   */
+  template <typename Subclass>
+  void simple_build_edge_ptr (AutoPtr<Elem>& edge,
+                              const unsigned int i,
+                              const ElemType edgetype) const;
+
 
 
  public:
@@ -1234,6 +1332,42 @@ protected:
 #endif
 };
 
+// ------------------------------------------------------------
+// Elem class template member functions
+template <typename Subclass>
+inline
+void Elem::simple_build_side_ptr (AutoPtr<Elem>& side,
+                                  const unsigned int i,
+                                  const ElemType sidetype) const
+{
+  libmesh_assert_less (i, this->n_sides());
+
+  this->prepare_side_ptr(side, sidetype);
+
+  const unsigned int n_side_nodes = side->n_nodes();
+  for (unsigned int n = 0; n != n_side_nodes; ++n)
+    side->set_node(n) = this->get_node(Subclass::side_nodes_map[i][n]);
+}
+
+
+
+template <typename Subclass>
+inline
+void Elem::simple_build_edge_ptr (AutoPtr<Elem>& edge,
+                                  const unsigned int i,
+                                  const ElemType edgetype) const
+{
+  libmesh_assert_less (i, this->n_edges());
+
+  this->prepare_side_ptr(edge, edgetype);
+
+  const unsigned int n_edge_nodes = edge->n_nodes();
+  for (unsigned int n = 0; n != n_edge_nodes; ++n)
+    edge->set_node(n) = this->get_node(Subclass::edge_nodes_map[i][n]);
+}
+
+
+
 // ------------------------------------------------------------
 // global Elem functions
 
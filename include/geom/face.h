@@ -69,6 +69,10 @@ public:
   AutoPtr<Elem> build_edge (const unsigned int i) const
   { return build_side(i); }
 
+  virtual void build_edge_ptr (AutoPtr<Elem>& edge,
+                               const unsigned int i) const
+  { this->build_side_ptr(edge, i); }
+
   /*
    * is_edge_on_side is trivial in 2D
    */
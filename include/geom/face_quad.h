@@ -120,6 +120,13 @@ public:
    */
   AutoPtr<Elem> side (const unsigned int i) const;
 
+  /**
+   * Rebuilds \p side as the primitive edge coincident with side
+   * \p i, reusing its storage when possible.
+   */
+  virtual void side_ptr (AutoPtr<Elem>& side,
+                         const unsigned int i) const;
+
   /**
    * Based on the quality metric q specified by the user,
    * returns a quantitative assessment of element quality.
@@ -133,6 +133,14 @@ public:
   AutoPtr<Elem> build_side (const unsigned int i,
                             bool proxy) const;
 
+  /**
+   * Rebuilds \p side as the full-ordered element coincident with
+   * side \p i, reusing its storage when possible.
+   */
+  virtual void build_side_ptr (AutoPtr<Elem>& side,
+                               const unsigned int i) const
+  { this->simple_build_side_ptr<Quad9>(side, i, EDGE3); }
+
   virtual void connectivity(const unsigned int sf,
                             const IOPackage iop,
                             std::vector<dof_id_type>& conn) const;
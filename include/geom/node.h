@@ -25,6 +25,7 @@
 #include "libmesh/dof_object.h"
 #include "libmesh/reference_counted_object.h"
 #include "libmesh/auto_ptr.h"
+#include "libmesh/slab_allocator.h"
 
 // C++ includes
 #include <iostream>
@@ -83,6 +84,17 @@ public:
    */
   ~Node ();
 
+#ifdef LIBMESH_ENABLE_SLAB_ALLOCATOR
+  /**
+   * Nodes are allocated from the slabs of the \p SlabAllocator.
+   */
+  static void* operator new (std::size_t size)
+  { return SlabAllocator::allocate(size); }
+
+  static void operator delete (void* p, std::size_t size)
+  { SlabAllocator::deallocate(p, size); }
+#endif
+
   /**
    * Assign to a node from a point
    */
@@ -197,6 +197,30 @@ public:
     return *this;
   }
 
+  /**
+   * Resets the \p StoredRange to contain [first,last), taken from
+   * some other kind of iterator, e.g. a \p FilteredElemRange
+   * iterator, whose dereferenced value converts to \p object_type.
+   */
+  template <typename other_iterator_type>
+  StoredRange<iterator_type, object_type> &
+  reset (const other_iterator_type &first,
+         const other_iterator_type &last)
+  {
+    _objs.clear();
+
+    for (other_iterator_type it=first; it!=last; ++it)
+      _objs.push_back(*it);
+
+    _begin = _objs.begin();
+    _end   = _objs.end();
+
+    _first = 0;
+    _last  = _objs.size();
+
+    return *this;
+  }
+
   /**
    * Resets the range to the last specified range.  This method only exists
    * for efficiency -- it is more efficient to set the range to its previous
@@ -24,6 +24,7 @@
 #include "libmesh/libmesh_common.h"
 #include "libmesh/id_types.h"
 #include "libmesh/parallel_object.h"
+#include "libmesh/vectormultimap.h"
 
 // C++ includes
 #include <cstddef>
@@ -298,6 +299,15 @@ public:
                         const unsigned short int side,
                         const boundary_id_type id) const;
 
+  /**
+   * Returns true iff the given side of the given element is
+   * associated with any id.  Once the mesh is prepared for use this
+   * is usually a constant-time lookup, so it is a cheap test to make
+   * before asking for the ids.
+   */
+  bool has_boundary_ids (const Elem* const elem,
+                         const unsigned short int side) const;
+
   /**
    * Returns the boundary id associated with the \p side side of
    * element \p elem.  Note that only one id per side is allowed,
@@ -498,25 +508,67 @@ private:
    * Data structure that maps nodes in the mesh
    * to boundary ids.
    */
-  std::multimap<const Node*,
-                boundary_id_type> _boundary_node_id;
+  vectormultimap<const Node*,
+                 boundary_id_type> _boundary_node_id;
 
   /**
    * Data structure that maps edges of elements
    * to boundary ids. This is only relevant in 3D.
    */
-  std::multimap<const Elem*,
-                std::pair<unsigned short int, boundary_id_type> >
+  vectormultimap<const Elem*,
+                 std::pair<unsigned short int, boundary_id_type> >
   _boundary_edge_id;
 
   /**
    * Data structure that maps sides of elements
    * to boundary ids.
    */
-  std::multimap<const Elem*,
-                std::pair<unsigned short int, boundary_id_type> >
+  vectormultimap<const Elem*,
+                 std::pair<unsigned short int, boundary_id_type> >
   _boundary_side_id;
 
+  /**
+   * What the side masks know about a side of an element.
+   */
+  enum SideMark { UNMARKED, MARKED, UNKNOWN };
+
+  /**
+   * Sorts the id maps and builds the side masks.  Called by
+   * \p MeshBase::prepare_for_use(), once the element ids are settled.
+   */
+  void build_side_masks ();
+
+  /**
+   * Brings the side mask of level-0 element \p elem up to date with
+   * \p _boundary_side_id, if the masks are built.
+   */
+  void update_side_mask (const Elem* const elem);
+
+  /**
+   * Drops level-0 element \p elem from the side masks.
+   */
+  void forget_side_mask (const Elem* const elem);
+
+  /**
+   * Looks up side \p side of level-0 element \p elem in the side
+   * masks.  Returns \p UNKNOWN if the masks are not built or do not
+   * know the element, in which case \p _boundary_side_id must be
+   * searched.
+   */
+  SideMark side_mark (const Elem* const elem,
+                      const unsigned short int side) const;
+
+  /**
+   * The side masks: for each element id, the level-0 element which
+   * had that id and a bit for each of its sides with boundary ids,
+   * so that sides without any can be recognized without a search.
+   * They cost 9 bytes per element, and are kept up to date by
+   * \p add_side() and \p remove_side() once built.
+   */
+  std::vector<const Elem*> _side_mask_elems;
+  std::vector<unsigned char> _side_masks;
+  bool _side_masks_valid;
+
   /**
    * A collection of user-specified boundary ids for sides, edges and nodes.
    * See _side_boundary_ids, _edge_boundary_ids and _node_boundary_ids
@@ -652,6 +704,9 @@ void BoundaryInfo::remove (const Elem* elem)
   // Erase everything associated with elem
   _boundary_edge_id.erase (elem);
   _boundary_side_id.erase (elem);
+
+  // Even if elem had no side ids, its id and address may be reused
+  this->forget_side_mask (elem);
 }
 
 } // namespace libMesh
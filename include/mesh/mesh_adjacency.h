@@ -0,0 +1,150 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2014 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+
+#ifndef LIBMESH_MESH_ADJACENCY_H
+#define LIBMESH_MESH_ADJACENCY_H
+
+// Local Includes -----------------------------------
+#include "libmesh/libmesh_common.h"
+#include "libmesh/id_types.h"
+
+// C++ Includes   -----------------------------------
+#include <cstddef>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward Declarations -----------------------------
+class Elem;
+class MeshBase;
+
+/**
+ * The \p MeshAdjacency class holds the node-to-element and
+ * element-to-element connectivity of a mesh in compressed sparse row
+ * form: one offset array indexed by id and one flat array of element
+ * pointers, instead of a separately allocated container per node or
+ * element.  Face neighbors are already stored on the elements
+ * themselves; this class adds the elements touching each node and
+ * the active elements touching each active element at any point.
+ * Only the node lists are built by the constructor; the point
+ * neighbor lists, which cost far more, are built on first use.
+ *
+ * The mesh owns one of these, built on demand by
+ * \p MeshBase::adjacency() and discarded whenever elements are
+ * added or removed, so it is normally only constructed directly for
+ * one-off use, as by the \p Tree point locator.
+ */
+class MeshAdjacency
+{
+public:
+
+  /**
+   * Iterator over the elements adjacent to a node or element.
+   */
+  typedef const Elem * const * const_iterator;
+
+  /**
+   * Constructor.  Builds the node-to-element connectivity of \p mesh
+   * (which, on a distributed mesh, covers the local and ghost
+   * elements).
+   */
+  explicit
+  MeshAdjacency (const MeshBase& mesh);
+
+  /**
+   * @returns the beginning of the list of elements, active or not,
+   * which contain the node with id \p node_id.  The elements appear
+   * in the order of the mesh element iterators.
+   */
+  const_iterator node_elems_begin (const dof_id_type node_id) const;
+
+  /**
+   * @returns the end of the list of elements which contain the node
+   * with id \p node_id.
+   */
+  const_iterator node_elems_end (const dof_id_type node_id) const;
+
+  /**
+   * @returns the number of elements which contain the node with id
+   * \p node_id.
+   */
+  unsigned int n_node_elems (const dof_id_type node_id) const
+  { return cast_int<unsigned int>(this->node_elems_end(node_id) -
+                                  this->node_elems_begin(node_id)); }
+
+  /**
+   * @returns the beginning of the list of active elements, including
+   * \p elem itself, which touch the active element \p elem at any
+   * point.  On refined meshes and on meshes mixing elements of
+   * different dimensions these are the elements
+   * \p Elem::find_point_neighbors() finds.  Otherwise they are the
+   * elements sharing a node with \p elem, which is the same set
+   * unless elements meet only at a node no chain of face neighbors
+   * around it connects them through, e.g. two cubes touching at a
+   * corner.  The list is sorted by address.  Inactive elements have
+   * empty lists.
+   *
+   * The lists of all the elements are built by the first call, which
+   * should not be made from within threaded code.
+   */
+  const_iterator point_neighbors_begin (const Elem* elem) const;
+
+  /**
+   * @returns the end of the list of point neighbors of \p elem.
+   */
+  const_iterator point_neighbors_end (const Elem* elem) const;
+
+  /**
+   * Builds the point neighbor lists, if that has not been done yet,
+   * so that threads may then look them up.
+   */
+  void build_point_neighbors () const;
+
+private:
+
+  /**
+   * The mesh whose connectivity this is.
+   */
+  const MeshBase& _mesh;
+
+  /**
+   * The elements containing node \p i are
+   * \p _node_elems[_node_offsets[i]] to
+   * \p _node_elems[_node_offsets[i+1]-1].
+   */
+  std::vector<std::size_t> _node_offsets;
+
+  std::vector<const Elem*> _node_elems;
+
+  /**
+   * The point neighbors of the element with id \p i are
+   * \p _point_neighbors[_elem_offsets[i]] to
+   * \p _point_neighbors[_elem_offsets[i+1]-1].  Both are empty until
+   * \p build_point_neighbors() is called.
+   */
+  mutable std::vector<std::size_t> _elem_offsets;
+
+  mutable std::vector<const Elem*> _point_neighbors;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_MESH_ADJACENCY_H
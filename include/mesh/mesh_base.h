@@ -28,15 +28,19 @@
 #include "libmesh/dof_object.h" // for invalid_processor_id
 #include "libmesh/enum_elem_type.h"
 #include "libmesh/libmesh_common.h"
+#include "libmesh/mesh_adjacency.h" // AutoPtr needs a real declaration
 #include "libmesh/multi_predicates.h"
 #include "libmesh/partitioner.h" // AutoPtr needs a real declaration
 #include "libmesh/point_locator_base.h"
+#include "libmesh/stored_range.h"
 #include "libmesh/variant_filter_iterator.h"
 #include "libmesh/parallel_object.h"
 
 // C++ Includes   -----------------------------------
 #include <cstddef>
+#include <map>
 #include <string>
+#include <vector>
 
 namespace libMesh
 {
@@ -384,6 +388,19 @@ public:
    */
   virtual Elem* query_elem (const dof_id_type i) = 0;
 
+  /**
+   * Gives direct access to the element pointers stored on this
+   * processor, one contiguous block at a time.  Start with \p block
+   * set to 0; each call sets [\p first, \p last) to the next block and
+   * returns true, or returns false when there are no more blocks.
+   * The blocks may contain NULL pointers.  This is the basis of the
+   * \p FilteredElemRange, and like the element iterators is
+   * invalidated by adding or removing elements.
+   */
+  virtual bool elem_ptr_block (std::size_t &block,
+                               Elem * const * &first,
+                               Elem * const * &last) const = 0;
+
   /**
    * Add a new \p Node at \p Point \p p to the end of the vertex array,
    * with processor_id \p procid.
@@ -469,6 +486,15 @@ public:
   virtual void find_neighbors (const bool reset_remote_elements = false,
                                const bool reset_current_list    = true) = 0;
 
+  /**
+   * Updates the neighbor links of a mesh whose links were valid
+   * before the elements in \p refined_parents were refined.  Only
+   * the new children and the elements which neighbored the refined
+   * parents are searched, which gives the same links as
+   * find_neighbors() at a fraction of the cost.
+   */
+  virtual void find_neighbors_of_children (const std::vector<Elem*>& refined_parents) = 0;
+
   /**
    * After partitoning a mesh it is useful to renumber the nodes and elements
    * so that they lie in contiguous blocks on the processors.  This method
@@ -476,6 +502,14 @@ public:
    */
   virtual void renumber_nodes_and_elements () = 0;
 
+  /**
+   * Reorders the elements of each processor along a space-filling
+   * curve.  Element ids may be left stale or non-contiguous, so this
+   * must be followed by \p renumber_nodes_and_elements(), which
+   * numbers the elements in the sorted order.
+   */
+  virtual void sort_elements_along_sfc () = 0;
+
   /**
    * There is no reason for a user to ever call this function.
    *
@@ -536,6 +570,21 @@ public:
   void allow_renumbering(bool allow) { _skip_renumber_nodes_and_elements = !allow; }
   bool allow_renumbering() const { return !_skip_renumber_nodes_and_elements; }
 
+  /**
+   * If true is passed in then prepare_for_use() will, before
+   * renumbering, sort the elements of each processor along a Hilbert
+   * space-filling curve through their centroids.  Neighboring
+   * elements, and the nodes and degrees of freedom numbered after
+   * them, then end up close together in memory, which can speed up
+   * assembly and solves on meshes read from poorly ordered files.
+   * This has no effect while renumbering is disallowed, or on a
+   * distributed mesh running on more than one processor.  A
+   * ParallelMesh numbers its nodes independently of its elements, so
+   * only the element numbering of a ParallelMesh follows the curve.
+   */
+  void allow_sfc_renumbering(bool allow) { _sfc_renumbering = allow; }
+  bool allow_sfc_renumbering() const { return _sfc_renumbering; }
+
   /**
    * If true is passed in then this mesh will no longer be (re)partitioned.
    * It would probably be a bad idea to call this on a Serial Mesh _before_
@@ -682,6 +731,73 @@ public:
    */
   void clear_point_locator ();
 
+  /**
+   * Recomputes the element bounding boxes cached by the current
+   * \p PointLocator object, if any, after nodes have moved.  Unlike
+   * \p clear_point_locator() this keeps the master locator, whose
+   * search structure servants such as those of a \p MeshFunction
+   * share.  The \p MeshTools::Modification functions and the mesh
+   * smoothers call it themselves.
+   */
+  void update_point_locator ();
+
+  /**
+   * Sets the type of the \p PointLocator built by \p point_locator()
+   * and \p sub_point_locator(), releasing the current one if the
+   * type changes.  The default is \p TREE; \p BVH is usually
+   * faster on large meshes.
+   */
+  void set_point_locator_type (PointLocatorType t);
+
+  /**
+   * \p returns the type of the \p PointLocator objects built for
+   * this mesh.
+   */
+  PointLocatorType point_locator_type () const
+  { return _point_locator_type; }
+
+  /**
+   * \p returns a range over the active elements owned by this
+   * processor, suitable for \p Threads::parallel_for() and
+   * \p Threads::parallel_reduce().  The element list is built on
+   * first use and then cached until the mesh is modified, so repeated
+   * assembly loops need not filter the whole element container again.
+   * Copies of the returned range share the cached list.  The cache
+   * should not first be built from within threaded code.
+   */
+  const StoredRange<const_element_iterator, const Elem*> &
+  active_local_element_range () const;
+
+  /**
+   * \p returns a cached range over the active elements owned by this
+   * processor in subdomain \p subdomain_id, like
+   * \p active_local_element_range().
+   */
+  const StoredRange<const_element_iterator, const Elem*> &
+  active_local_subdomain_element_range (const subdomain_id_type subdomain_id) const;
+
+  /**
+   * \p returns the node-to-element and element-to-element
+   * connectivity of this mesh.  It is built on first use and then
+   * cached until the mesh is modified, so it should be preferred to
+   * \p MeshTools::build_nodes_to_elem_map() and repeated calls to
+   * \p Elem::find_point_neighbors().  The cache, and its point
+   * neighbor lists, should not first be built from within threaded
+   * code.
+   */
+  const MeshAdjacency & adjacency () const;
+
+  /**
+   * Releases the cached element lists and connectivity.  This is
+   * done automatically when elements are added or deleted, by
+   * \p prepare_for_use(), \p partition() and the \p Partitioner
+   * classes, and by \p MeshTools::Modification::change_subdomain_id();
+   * code which changes the nodes, processor ids, subdomain ids or
+   * refinement state of existing elements by hand should call it
+   * afterwards.
+   */
+  void clear_element_caches ();
+
   /**
    * Verify id and processor_id consistency of our elements and
    * nodes containers.
@@ -897,6 +1013,32 @@ protected:
    */
   mutable AutoPtr<PointLocatorBase> _point_locator;
 
+  /**
+   * The type of \p _point_locator and its servants.
+   */
+  PointLocatorType _point_locator_type;
+
+  /**
+   * The cached active local elements, built on demand by
+   * \p active_local_element_range().  Only valid while
+   * \p _active_local_elem_range_valid is true.
+   */
+  mutable StoredRange<const_element_iterator, const Elem*> _active_local_elem_range;
+
+  mutable bool _active_local_elem_range_valid;
+
+  /**
+   * The cached active local elements of each subdomain, built on
+   * demand by \p active_local_subdomain_element_range().
+   */
+  mutable std::map<subdomain_id_type, StoredRange<const_element_iterator, const Elem*> >
+  _active_local_subdomain_elem_ranges;
+
+  /**
+   * The cached connectivity, built on demand by \p adjacency().
+   */
+  mutable AutoPtr<MeshAdjacency> _adjacency;
+
   /**
    * A partitioner to use at each prepare_for_use().
    *
@@ -924,6 +1066,12 @@ protected:
    */
   bool _skip_renumber_nodes_and_elements;
 
+  /**
+   * If this is true then prepare_for_use() sorts the elements along
+   * a space-filling curve before renumbering them.
+   */
+  bool _sfc_renumbering;
+
   /**
    * This structure maintains the mapping of named blocks
    * for file formats that support named blocks.  Currently
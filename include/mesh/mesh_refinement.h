@@ -30,6 +30,7 @@
 #include "libmesh/libmesh_common.h"
 #include "libmesh/libmesh.h" // libMesh::invalid_uint
 #include "libmesh/location_maps.h"
+#include "libmesh/topology_map.h"
 #include "libmesh/elem.h"
 #include "libmesh/point_locator_base.h"
 #include "libmesh/parallel_object.h"
@@ -308,6 +309,19 @@ public:
                    const processor_id_type proc_id,
                    const Real tol);
 
+  /**
+   * Add node \p nc of child \p c of \p parent, located at \p p,
+   * to the mesh, unless it already exists.  The function returns a
+   * pointer to the node.  Existing nodes are found as described in
+   * use_topology_map(), or as in add_point() otherwise.
+   */
+  Node* add_node (const Elem& parent,
+                  const unsigned int c,
+                  const unsigned int nc,
+                  const Point& p,
+                  const processor_id_type proc_id,
+                  const Real tol);
+
   /**
    * Adds the element \p elem to the mesh.
    */
@@ -334,6 +348,17 @@ public:
    */
   bool& coarsen_by_parents();
 
+  /**
+   * If \p use_topology_map is true, the nodes created by refinement
+   * are identified by the parent nodes they are interpolated from,
+   * rather than by their location.  This is cheaper and exact,
+   * even on badly scaled or curved meshes, but can only match the
+   * nodes of refined elements.
+   *
+   * \p use_topology_map is false by default.
+   */
+  bool& use_topology_map();
+
   /**
    * The \p refine_fraction sets either a desired target or a desired
    * maximum number of elements to flag for refinement, depending on which
@@ -470,6 +495,15 @@ private:
    */
   bool _refine_elements ();
 
+  /**
+   * Refines the given elements, all of which must be flagged for
+   * refinement.  The children and the locations of their nodes are
+   * built on all threads; the new nodes and elements are then added
+   * to the mesh in order, so the result and its ids are the same as
+   * when calling Elem::refine() on each element in turn.
+   */
+  void _refine_elements_threaded (const std::vector<Elem*>& elements);
+
 
 
   //------------------------------------------------------
@@ -654,6 +688,17 @@ private:
    */
   LocationMap<Node> _new_nodes_map;
 
+  /**
+   * Data structure that holds the new nodes information, keyed
+   * by topology when \p _use_topology_map is set.
+   */
+  TopologyMap _topology_map;
+
+  /**
+   * Whether to match new nodes with \p _topology_map
+   */
+  bool _use_topology_map;
+
   /**
    * Reference to the mesh.
    */
@@ -786,6 +831,11 @@ inline bool& MeshRefinement::coarsen_by_parents()
   return _coarsen_by_parents;
 }
 
+inline bool& MeshRefinement::use_topology_map()
+{
+  return _use_topology_map;
+}
+
 inline Real& MeshRefinement::refine_fraction()
 {
   _use_member_parameters = true;
@@ -139,7 +139,9 @@ dof_id_type weight (const MeshBase &mesh)
  * After calling this function the input vector \p nodes_to_elem_map
  * will contain the node to element connectivity.  That is to say
  * \p nodes_to_elem_map[i][j] is the global number of \f$ j^{th} \f$
- * element connected to node \p i.
+ * element connected to node \p i.  The map is copied out of the
+ * connectivity cached by \p MeshBase::adjacency(), which can be
+ * used directly instead to avoid the copy.
  */
 void build_nodes_to_elem_map (const MeshBase &mesh,
                               std::vector<std::vector<dof_id_type> > &nodes_to_elem_map);
@@ -209,6 +211,17 @@ Sphere
 subdomain_bounding_sphere (const MeshBase &mesh,
                            const subdomain_id_type sid);
 
+/**
+ * @returns the position of \p p along a Hilbert space-filling curve
+ * through the box \p bbox, with 21 bits of resolution in each
+ * direction.  Points which are close along the curve are close in
+ * space, so sorting objects by this key gives them good memory
+ * locality.  Points outside the box are clamped to it.
+ */
+uint64_t
+hilbert_key (const Point &p,
+             const BoundingBox &bbox);
+
 
 /**
  * Return a vector of all element types for the mesh.  Implemented
@@ -317,6 +330,13 @@ void find_nodal_neighbors(const MeshBase &mesh, const Node &n,
                           std::vector<std::vector<const Elem*> > &nodes_to_elem_map,
                           std::vector<const Node*> &neighbors);
 
+/**
+ * The same, except the node to element connectivity is taken from
+ * \p MeshBase::adjacency().
+ */
+void find_nodal_neighbors(const MeshBase &mesh, const Node &n,
+                          std::vector<const Node*> &neighbors);
+
 /**
  * Given a mesh hanging_nodes will be filled with an associative array keyed off the
  * global id of all the hanging nodes in the mesh.  It will hold an array of the
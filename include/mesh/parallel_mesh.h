@@ -153,6 +153,13 @@ public:
    */
   virtual void renumber_nodes_and_elements ();
 
+  /**
+   * Sorts the local elements along a Hilbert curve by permuting the
+   * ids this processor already owns, and updates ghost copies on
+   * other processors to match.
+   */
+  virtual void sort_elements_along_sfc ();
+
   /**
    * Gathers all elements and nodes of the mesh onto
    * every processor
@@ -207,6 +214,9 @@ public:
   virtual Elem* elem (const dof_id_type i) ;
   virtual const Elem* query_elem (const dof_id_type i) const ;
   virtual Elem* query_elem (const dof_id_type i) ;
+  virtual bool elem_ptr_block (std::size_t &block,
+                               Elem * const * &first,
+                               Elem * const * &last) const ;
 
   /**
    * functions for adding /deleting nodes elements.
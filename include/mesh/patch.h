@@ -34,6 +34,7 @@ namespace libMesh
 
 // Forward Declarations
 class Elem;
+class MeshAdjacency;
 
 
 
@@ -50,9 +51,14 @@ public:
 
   /**
    * Constructor. Requires the processor ID to be interpreted as "local".
+   * If the connectivity \p adjacency of the mesh is given, point
+   * neighbors are looked up in it instead of being searched for
+   * element by element.
    */
-  Patch(const processor_id_type my_procid = static_cast<processor_id_type>(-1)) :
-    _my_procid(my_procid)
+  Patch(const processor_id_type my_procid = static_cast<processor_id_type>(-1),
+        const MeshAdjacency* adjacency = NULL) :
+    _my_procid(my_procid),
+    _adjacency(adjacency)
   {}
 
   /**
@@ -103,6 +109,13 @@ public:
    */
   typedef void (Patch::*PMF)();
 
+  /**
+   * @returns true if \p patchtype grows a patch by point neighbors,
+   * which it then looks up in the mesh connectivity if the patch was
+   * given it.
+   */
+  static bool grows_by_point_neighbors (PMF patchtype);
+
   /**
    * Erases any elements in the current patch, then builds a new patch
    * containing element \p elem by repeated addition of neighbors on
@@ -129,6 +142,11 @@ protected:
   void find_point_neighbors(std::set<const Elem *> &neighbor_set);
 
   const processor_id_type _my_procid;
+
+  /**
+   * The mesh connectivity, if we were given it.
+   */
+  const MeshAdjacency* _adjacency;
 };
 
 } // namespace libMesh
@@ -101,6 +101,11 @@ public:
    */
   virtual void renumber_nodes_and_elements ();
 
+  /**
+   * Sorts the elements of each processor along a Hilbert curve
+   */
+  virtual void sort_elements_along_sfc ();
+
   virtual dof_id_type n_nodes () const
   { return cast_int<dof_id_type>(_nodes.size()); }
 
@@ -140,6 +145,9 @@ public:
   virtual Elem* elem (const dof_id_type i) ;
   virtual const Elem* query_elem (const dof_id_type i) const ;
   virtual Elem* query_elem (const dof_id_type i) ;
+  virtual bool elem_ptr_block (std::size_t &block,
+                               Elem * const * &first,
+                               Elem * const * &last) const ;
 
   /**
    * functions for adding /deleting nodes elements.
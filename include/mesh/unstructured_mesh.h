@@ -163,6 +163,8 @@ public:
   virtual void find_neighbors (const bool reset_remote_elements = false,
                                const bool reset_current_list    = true);
 
+  virtual void find_neighbors_of_children (const std::vector<Elem*>& refined_parents);
+
 #ifdef LIBMESH_ENABLE_AMR
   /**
    * Delete subactive (i.e. children of coarsened) elements.
@@ -0,0 +1,136 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2014 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_MATRIX_INSERTION_BUFFER_H
+#define LIBMESH_MATRIX_INSERTION_BUFFER_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/dense_matrix.h"
+#include "libmesh/id_types.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <cstddef>
+#include <vector>
+
+namespace libMesh
+{
+
+// forward declarations
+template <typename T> class SparseMatrix;
+
+
+/**
+ * Per-thread staging area for element matrix contributions to a
+ * \p SparseMatrix.  Each assembly thread owns one buffer and
+ * appends its element matrices to it as (row, column, value)
+ * triplets without any locking.  When the buffer is flushed the
+ * triplets are sorted, duplicates are summed, and the result is
+ * added to the matrix one block of rows (sharing the same columns)
+ * at a time, while holding a mutex shared by all threads writing to
+ * the matrix.  This replaces one locked \p add_matrix() call per
+ * element by one per row block.
+ *
+ * The buffer flushes itself whenever it holds more than
+ * \p max_entries triplets, to bound its memory use; \p flush() must
+ * be called once the owning thread is done adding to it.
+ *
+ * The triplets are merged by sorting them, not by walking the
+ * sparsity pattern of the matrix, so the buffer works with any
+ * \p SparseMatrix.
+ */
+template <typename T>
+class MatrixInsertionBuffer
+{
+public:
+
+  /**
+   * Constructor.  Contributions will be added to \p matrix while
+   * holding \p mutex, which should be shared by every thread (and
+   * every other buffer) writing to \p matrix.
+   */
+  MatrixInsertionBuffer (SparseMatrix<T> &matrix,
+                         Threads::spin_mutex &mutex = Threads::spin_mtx,
+                         const std::size_t max_entries = 1000000);
+
+  /**
+   * Stages the element matrix \p dm for addition to rows \p rows and
+   * columns \p cols of the matrix.
+   */
+  void add_matrix (const DenseMatrix<T> &dm,
+                   const std::vector<numeric_index_type> &rows,
+                   const std::vector<numeric_index_type> &cols);
+
+  /**
+   * Same as \p add_matrix, but assumes the row and column maps are the same.
+   */
+  void add_matrix (const DenseMatrix<T> &dm,
+                   const std::vector<numeric_index_type> &dof_indices)
+  { this->add_matrix (dm, dof_indices, dof_indices); }
+
+  /**
+   * Adds all staged contributions to the matrix and empties the
+   * buffer.
+   */
+  void flush ();
+
+  /**
+   * \returns the number of staged (row, column, value) triplets.
+   */
+  std::size_t size () const { return _entries.size(); }
+
+private:
+
+  /**
+   * A single staged contribution, ordered by row and then column.
+   */
+  struct Entry
+  {
+    numeric_index_type row, col;
+    T value;
+
+    bool operator< (const Entry &other) const
+    { return (row < other.row) || (row == other.row && col < other.col); }
+  };
+
+  /**
+   * Adds the current row block to the matrix.
+   */
+  void add_block ();
+
+  SparseMatrix<T> &_matrix;
+
+  Threads::spin_mutex &_mutex;
+
+  const std::size_t _max_entries;
+
+  std::vector<Entry> _entries;
+
+  /**
+   * Workspace for assembling row blocks during \p flush().
+   */
+  std::vector<numeric_index_type> _block_rows, _block_cols;
+  std::vector<T> _block_values;
+  DenseMatrix<T> _block;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_MATRIX_INSERTION_BUFFER_H
@@ -48,6 +48,7 @@
 #  include "libmesh/libmesh_logging.h" // only mess with the perflog if we are really multithreaded
 #  include <pthread.h>
 #  include <algorithm>
+#  include <utility>
 #  include <vector>
 
 #ifdef __APPLE__
@@ -438,58 +439,216 @@ extern spin_mutex _pthread_unique_id_mutex;
  */
 unsigned int pthread_unique_id();
 
+//-------------------------------------------------------------------
+/**
+ * Dummy "splitting object" used to distinguish splitting constructors
+ * from copy constructors.
+ */
+class split {};
+
+//-------------------------------------------------------------------
+/**
+ * Persistent pool of worker threads used to execute \p parallel_for
+ * and \p parallel_reduce when TBB is not available.  The pool is
+ * started by \p task_scheduler_init (which \p LibMeshInit builds from
+ * the \p --n_threads command line argument) and the workers sleep
+ * between parallel calls, so no threads are created or destroyed
+ * during e.g. assembly.
+ *
+ * The calling thread always participates as worker 0; the pool
+ * threads are workers 1 through \p n_threads()-1, and
+ * \p pthread_unique_id() returns these worker numbers.
+ */
+class ThreadPool
+{
+public:
+  /**
+   * Abstract unit of work.  \p run() is called once on each
+   * participating worker, concurrently, with the worker number.
+   */
+  class Job
+  {
+  public:
+    virtual ~Job () {}
+    virtual void run (unsigned int worker) = 0;
+  };
+
+  /**
+   * Starts \p n_threads-1 pool threads, stopping any previously
+   * started ones first.  Should only be called from the main thread.
+   */
+  static void initialize (unsigned int n_threads);
+
+  /**
+   * Stops and joins all pool threads.
+   */
+  static void terminate ();
+
+  /**
+   * \returns the number of workers available, including the calling
+   * thread.  Returns 1 if the pool has not been started.
+   */
+  static unsigned int n_threads ();
+
+  /**
+   * Runs \p job on workers \p 0 through \p n_workers-1 and returns
+   * once every worker has finished.  Worker 0 is the calling thread.
+   */
+  static void execute (Job &job, unsigned int n_workers);
+};
+
+/**
+ * Recursively splits \p range with its splitting constructor until the
+ * pieces are no longer divisible (i.e. they respect the range's
+ * grainsize) or there are roughly \p max_pieces of them, and appends
+ * the pieces to \p pieces in order.
+ */
 template <typename Range>
-unsigned int num_pthreads(Range & range)
+void split_range (const Range &range,
+                  const std::size_t max_pieces,
+                  std::vector<Range> &pieces)
 {
-  unsigned int min = std::min((std::size_t)libMesh::n_threads(), range.size());
-  return min > 0 ? min : 1;
+  // Each stack entry holds a subrange and its depth in the split tree
+  std::vector<std::pair<Range, unsigned int> > stack
+    (1, std::make_pair(range, 0u));
+
+  unsigned int max_depth = 0;
+  while ((std::size_t(1) << max_depth) < max_pieces)
+    max_depth++;
+
+  while (!stack.empty())
+    {
+      Range left = stack.back().first;
+      const unsigned int depth = stack.back().second;
+      stack.pop_back();
+
+      if (depth < max_depth && left.is_divisible())
+        {
+          // The splitting constructor leaves the first half in left
+          Range right(left, Threads::split());
+          stack.push_back(std::make_pair(right, depth+1));
+          stack.push_back(std::make_pair(left, depth+1));
+        }
+      else
+        pieces.push_back(left);
+    }
 }
 
+/**
+ * \p ThreadPool job which applies one body per worker to a set of
+ * subranges.  Each worker starts with a contiguous block of the
+ * subranges and works through it in order; a worker which runs out of
+ * work steals the back half of the largest remaining block, so uneven
+ * per-element costs do not leave threads idle.
+ */
 template <typename Range, typename Body>
-class RangeBody
+class RangeJob : public ThreadPool::Job
 {
 public:
-  Range * range;
-  Body * body;
+  RangeJob (const std::vector<Range> &pieces,
+            const std::vector<Body *> &bodies) :
+    _pieces(pieces),
+    _bodies(bodies),
+    _head(bodies.size()),
+    _tail(bodies.size())
+  {
+    const std::size_t n_workers = bodies.size();
+    for (std::size_t w=0; w != n_workers; ++w)
+      {
+        _head[w] = w * pieces.size() / n_workers;
+        _tail[w] = (w+1) * pieces.size() / n_workers;
+      }
+  }
+
+  virtual void run (unsigned int worker)
+  {
+    Body &body = *_bodies[worker];
+
+    std::size_t piece;
+    while (this->next_piece(worker, piece))
+      body(_pieces[piece]);
+  }
+
+private:
+  /**
+   * Pops the next subrange for \p worker, stealing from another worker
+   * if necessary.  Returns false once all work has been handed out.
+   */
+  bool next_piece (unsigned int worker, std::size_t &piece)
+  {
+    spin_mutex::scoped_lock lock(_mutex);
+
+    if (_head[worker] == _tail[worker])
+      {
+        // Find the worker with the most remaining subranges
+        std::size_t victim = worker, most = 0;
+        for (std::size_t w=0; w != _head.size(); ++w)
+          if (_tail[w] - _head[w] > most)
+            {
+              victim = w;
+              most = _tail[w] - _head[w];
+            }
+
+        if (!most)
+          return false;
+
+        // Take the back half (rounding up) of its block
+        _tail[worker] = _tail[victim];
+        _tail[victim] -= (most + 1) / 2;
+        _head[worker] = _tail[victim];
+      }
+
+    piece = _head[worker]++;
+    return true;
+  }
+
+  const std::vector<Range> &_pieces;
+  const std::vector<Body *> &_bodies;
+  std::vector<std::size_t> _head, _tail;
+  spin_mutex _mutex;
 };
 
-template <typename Range, typename Body>
-void * run_body(void * args)
+/**
+ * Splits \p range into pieces for the thread pool.  Returns false if
+ * the range should simply be executed serially.
+ */
+template <typename Range>
+bool split_for_pool (const Range &range,
+                     std::vector<Range> &pieces)
 {
+  const unsigned int n_workers = ThreadPool::n_threads();
 
-  RangeBody<Range, Body> * range_body = (RangeBody<Range, Body>*)args;
+  if (n_workers < 2 || !range.is_divisible())
+    return false;
 
-  Body & body = *range_body->body;
-  Range & range = *range_body->range;
+  // Over-decompose so that work stealing has something to balance,
+  // similar to TBB's auto_partitioner.
+  split_range(range, 8*n_workers, pieces);
 
-  body(range);
-
-  return NULL;
+  return (pieces.size() > 1);
 }
 
 //-------------------------------------------------------------------
 /**
- * Scheduler to manage threads.
+ * Scheduler to manage threads.  Starts the persistent \p ThreadPool
+ * on construction and stops it on destruction.
  */
 class task_scheduler_init
 {
 public:
   static const int automatic = -1;
-  explicit task_scheduler_init (int = automatic) {}
-  void initialize (int = automatic) {}
-  void terminate () {}
+  explicit task_scheduler_init (int n_threads = automatic)
+  { this->initialize(n_threads); }
+  ~task_scheduler_init () { this->terminate(); }
+  void initialize (int n_threads = automatic)
+  {
+    ThreadPool::initialize
+      (n_threads == automatic ? libMesh::n_threads() :
+       static_cast<unsigned int>(n_threads));
+  }
+  void terminate () { ThreadPool::terminate(); }
 };
 
-//-------------------------------------------------------------------
-/**
- * Dummy "splitting object" used to distinguish splitting constructors
- * from copy constructors.
- */
-class split {};
-
-
-
-
 //-------------------------------------------------------------------
 /**
  * Exectue the provided function object in parallel on the specified
@@ -508,62 +667,22 @@ void parallel_for (const Range &range, const Body &body)
     libMesh::perflog.disable_logging();
 #endif
 
-  unsigned int n_threads = num_pthreads(range);
-
-  std::vector<Range *> ranges(n_threads);
-  std::vector<RangeBody<const Range, const Body> > range_bodies(n_threads);
-  std::vector<pthread_t> threads(n_threads);
-
-  // Create the ranges for each thread
-  unsigned int range_size = range.size() / n_threads;
-
-  typename Range::const_iterator current_beginning = range.begin();
-
-  for(unsigned int i=0; i<n_threads; i++)
-    {
-      unsigned int this_range_size = range_size;
-
-      if(i+1 == n_threads)
-        this_range_size += range.size() % n_threads; // Give the last one the remaining work to do
+  std::vector<Range> pieces;
 
-      ranges[i] = new Range(range, current_beginning, current_beginning + this_range_size);
-
-      current_beginning = current_beginning + this_range_size;
-    }
+  if (!split_for_pool(range, pieces))
+    body(range);
 
-  // Create the RangeBody arguments
-  for(unsigned int i=0; i<n_threads; i++)
+  else
     {
-      range_bodies[i].range = ranges[i];
-      range_bodies[i].body = &body;
-    }
+      const unsigned int n_workers =
+        std::min(std::size_t(ThreadPool::n_threads()), pieces.size());
 
-  // Create the threads
-#pragma omp parallel for schedule (static)
-  for(unsigned int i=0; i<n_threads; i++)
-    {
-#if LIBMESH_HAVE_OPENMP
-      run_body<Range, Body>((void*)&range_bodies[i]);
-#else // Just use Pthreads
-      spin_mutex::scoped_lock lock(_pthread_unique_id_mutex);
-      pthread_create(&threads[i], NULL, &run_body<Range, Body>, (void*)&range_bodies[i]);
-      _pthread_unique_ids[threads[i]] = i;
-#endif
-    }
+      // Every worker shares the same (const) body
+      std::vector<const Body *> bodies(n_workers, &body);
 
-#if !LIBMESH_HAVE_OPENMP
-  // Wait for them to finish
-  for(unsigned int i=0; i<n_threads; i++)
-    {
-      pthread_join(threads[i], NULL);
-      spin_mutex::scoped_lock lock(_pthread_unique_id_mutex);
-      _pthread_unique_ids.erase(threads[i]);
+      RangeJob<Range, const Body> job(pieces, bodies);
+      ThreadPool::execute(job, n_workers);
     }
-#endif
-
-  // Clean up
-  for(unsigned int i=0; i<n_threads; i++)
-    delete ranges[i];
 
 #ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
   if (libMesh::n_threads() > 1 && logging_was_enabled)
@@ -601,75 +720,34 @@ void parallel_reduce (const Range &range, Body &body)
     libMesh::perflog.disable_logging();
 #endif
 
-  unsigned int n_threads = num_pthreads(range);
-
-  std::vector<Range *> ranges(n_threads);
-  std::vector<Body *> bodies(n_threads);
-  std::vector<RangeBody<Range, Body> > range_bodies(n_threads);
-
-  // Create copies of the body for each thread
-  bodies[0] = &body; // Use the original body for the first one
-  for(unsigned int i=1; i<n_threads; i++)
-    bodies[i] = new Body(body, Threads::split());
-
-  // Create the ranges for each thread
-  unsigned int range_size = range.size() / n_threads;
-
-  typename Range::const_iterator current_beginning = range.begin();
-
-  for(unsigned int i=0; i<n_threads; i++)
-    {
-      unsigned int this_range_size = range_size;
-
-      if(i+1 == n_threads)
-        this_range_size += range.size() % n_threads; // Give the last one the remaining work to do
-
-      ranges[i] = new Range(range, current_beginning, current_beginning + this_range_size);
+  std::vector<Range> pieces;
 
-      current_beginning = current_beginning + this_range_size;
-    }
-
-  // Create the RangeBody arguments
-  for(unsigned int i=0; i<n_threads; i++)
-    {
-      range_bodies[i].range = ranges[i];
-      range_bodies[i].body = bodies[i];
-    }
-
-  // Create the threads
-  std::vector<pthread_t> threads(n_threads);
-
-#pragma omp parallel for schedule (static)
-  for(unsigned int i=0; i<n_threads; i++)
-    {
-#if LIBMESH_HAVE_OPENMP
-      run_body<Range, Body>((void*)&range_bodies[i]);
-#else // Just use Pthreads
-      spin_mutex::scoped_lock lock(_pthread_unique_id_mutex);
-      pthread_create(&threads[i], NULL, &run_body<Range, Body>, (void*)&range_bodies[i]);
-      _pthread_unique_ids[threads[i]] = i;
-#endif
-    }
+  if (!split_for_pool(range, pieces))
+    body(range);
 
-#if !LIBMESH_HAVE_OPENMP
-  // Wait for them to finish
-  for(unsigned int i=0; i<n_threads; i++)
+  else
     {
-      pthread_join(threads[i], NULL);
-      spin_mutex::scoped_lock lock(_pthread_unique_id_mutex);
-      _pthread_unique_ids.erase(threads[i]);
+      const unsigned int n_workers =
+        std::min(std::size_t(ThreadPool::n_threads()), pieces.size());
+
+      // Create copies of the body for each worker, using the
+      // original body for the first one
+      std::vector<Body *> bodies(n_workers);
+      bodies[0] = &body;
+      for (unsigned int i=1; i<n_workers; i++)
+        bodies[i] = new Body(body, Threads::split());
+
+      RangeJob<Range, Body> job(pieces, bodies);
+      ThreadPool::execute(job, n_workers);
+
+      // Join them all down to the original Body
+      for (unsigned int i=n_workers-1; i != 0; i--)
+        bodies[i-1]->join(*bodies[i]);
+
+      // Clean up
+      for (unsigned int i=1; i<n_workers; i++)
+        delete bodies[i];
     }
-#endif
-
-  // Join them all down to the original Body
-  for(unsigned int i=n_threads-1; i != 0; i--)
-    bodies[i-1]->join(*bodies[i]);
-
-  // Clean up
-  for(unsigned int i=1; i<n_threads; i++)
-    delete bodies[i];
-  for(unsigned int i=0; i<n_threads; i++)
-    delete ranges[i];
 
 #ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
   if (libMesh::n_threads() > 1 && logging_was_enabled)
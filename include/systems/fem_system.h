@@ -22,10 +22,12 @@
 
 // Local Includes
 #include "libmesh/diff_system.h"
+#include "libmesh/elem_range.h"
 #include "libmesh/fem_physics.h"
 
 // C++ includes
 #include <cstddef>
+#include <vector>
 
 namespace libMesh
 {
@@ -86,6 +88,12 @@ public:
    */
   virtual void clear ();
 
+  /**
+   * Reinitializes the member data fields associated with
+   * the system, discarding any cached element coloring.
+   */
+  virtual void reinit ();
+
   /**
    * Prepares \p matrix or \p rhs for matrix assembly.
    * Users may reimplement this to add pre- or post-assembly
@@ -190,6 +198,32 @@ public:
    */
   Real verify_analytic_jacobians;
 
+  /**
+   * If colored_assembly is true, assembly() splits the active local
+   * elements into colors which share no degrees of freedom and
+   * assembles one color at a time.  Each thread stages the element
+   * jacobians and residuals of its range of elements and adds them to
+   * the global system under the assembly lock once per range, since
+   * none of the numerics packages support concurrent insertion.  The
+   * coloring is cached until the system is reinitialized.
+   *
+   * It is false by default.  Systems with SCALAR variables, which
+   * couple to every element, always use uncolored assembly.
+   */
+  bool colored_assembly;
+
+  /**
+   * If staged_assembly is true, assembly() threads stage their
+   * element jacobians in a MatrixInsertionBuffer and add them to the
+   * global matrix in sorted row blocks at the end of each range of
+   * elements handed to the thread by Threads::parallel_for() (a
+   * thread may be handed several), rather than locking once per
+   * element.  This trades extra memory and a sort for fewer matrix
+   * insertion calls and less lock contention.  It is false by
+   * default, but colored assembly always stages.
+   */
+  bool staged_assembly;
+
   /**
    * Syntax sugar to make numerical_jacobian() declaration easier.
    */
@@ -229,6 +263,22 @@ protected:
    * the system, so that, e.g., \p assemble() may be used.
    */
   virtual void init_data ();
+
+private:
+  /**
+   * Builds \p _element_colors from the current mesh and DofMap.
+   */
+  void build_element_colors ();
+
+  /**
+   * Discards the cached element coloring.
+   */
+  void clear_element_colors ();
+
+  /**
+   * Element ranges for each color used by colored assembly.
+   */
+  std::vector<ConstElemRange*> _element_colors;
 };
 
 
@@ -0,0 +1,176 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2014 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_POINT_EVALUATOR_H
+#define LIBMESH_POINT_EVALUATOR_H
+
+// Local Includes
+#include "libmesh/auto_ptr.h"
+#include "libmesh/fe_type.h"
+#include "libmesh/parallel_object.h"
+#include "libmesh/point.h"
+#include "libmesh/tensor_value.h"
+#include "libmesh/vector_value.h"
+
+// C++ includes
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace libMesh
+{
+
+
+// Forward Declarations
+template <typename T> class FEGenericBase;
+typedef FEGenericBase<Real> FEBase;
+class PointLocatorBase;
+class System;
+
+
+/**
+ * This class evaluates the solution of a \p System, and its
+ * gradient and hessian, at arbitrary points of the mesh, like
+ * \p System::point_value(), \p System::point_gradient() and
+ * \p System::point_hessian() do.  Unlike those it keeps its point
+ * locator and the \p FE objects it builds for each dimension and
+ * finite element type from one evaluation to the next, and it
+ * evaluates all the variables at a whole vector of points with one
+ * reduction, so that it is cheap to use for many monitor points at
+ * every time step.
+ *
+ * The point locator is a \p MeshBase::sub_point_locator(), so like
+ * a \p MeshFunction this object has to be cleared and re-initialized
+ * whenever the mesh changes.  The solution used is whatever the
+ * system's \p current_local_solution is at the time of each
+ * evaluation.
+ *
+ * The evaluations are collective, and every processor must ask for
+ * the same points.
+ */
+class PointEvaluator : public ParallelObject
+{
+public:
+  /**
+   * Constructor.  Needs the \p system whose solution is evaluated.
+   */
+  explicit
+  PointEvaluator (const System& system);
+
+  /**
+   * Destructor.
+   */
+  ~PointEvaluator ();
+
+  /**
+   * Builds the point locator.  Called by the evaluations when
+   * necessary.
+   */
+  void init ();
+
+  /**
+   * Frees the point locator and the \p FE objects.
+   */
+  void clear ();
+
+  /**
+   * @returns \p true when this object is properly initialized
+   * and ready for use, \p false otherwise.
+   */
+  bool initialized () const;
+
+  /**
+   * Sets \p values[i][var] to the value of variable \p var of the
+   * solution at \p points[i].
+   *
+   * By default every point has to be in the mesh.  If
+   * \p insist_on_success is \p false the values at points which are
+   * not are zero.
+   */
+  void point_values (const std::vector<Point>& points,
+                     std::vector<std::vector<Number> >& values,
+                     const bool insist_on_success = true);
+
+  /**
+   * Sets \p gradients[i][var] to the gradient of variable \p var of
+   * the solution at \p points[i], similarly to \p point_values().
+   */
+  void point_gradients (const std::vector<Point>& points,
+                        std::vector<std::vector<Gradient> >& gradients,
+                        const bool insist_on_success = true);
+
+  /**
+   * Sets \p hessians[i][var] to the second derivative tensor of
+   * variable \p var of the solution at \p points[i], similarly to
+   * \p point_values().  Requires --enable-second.
+   */
+  void point_hessians (const std::vector<Point>& points,
+                       std::vector<std::vector<Tensor> >& hessians,
+                       const bool insist_on_success = true);
+
+private:
+  /**
+   * Evaluates the values (\p derivative_order 0), gradients (1) or
+   * hessians (2) of all the variables at all the \p points, and
+   * returns their components, variable by variable and point by
+   * point, in \p components.
+   */
+  void evaluate (const std::vector<Point>& points,
+                 const unsigned int derivative_order,
+                 const bool insist_on_success,
+                 std::vector<Number>& components);
+
+  /**
+   * @returns the cached \p FE object computing the shape functions'
+   * values (\p derivative_order 0), gradients (1) or hessians (2)
+   * for elements of dimension \p dim and type \p fe_type, building
+   * it when first asked for.
+   */
+  FEBase & get_fe (const unsigned int derivative_order,
+                   const unsigned int dim,
+                   const FEType& fe_type);
+
+  /**
+   * The system whose solution is evaluated.
+   */
+  const System& _system;
+
+  /**
+   * The point locator.
+   */
+  AutoPtr<PointLocatorBase> _point_locator;
+
+  /**
+   * The \p FE objects, for each derivative order, element dimension
+   * and finite element type.  An \p FE object has to be told what to
+   * compute before it is first reinitialized, so each order gets its
+   * own.
+   */
+  std::map<std::pair<unsigned int, FEType>, FEBase*> _fe[3];
+
+  /**
+   * \p true when properly initialized, \p false otherwise.
+   */
+  bool _initialized;
+};
+
+
+} // namespace libMesh
+
+#endif // LIBMESH_POINT_EVALUATOR_H
@@ -1536,7 +1536,9 @@ public:
    * afterward.  Also, point_locator() is expensive (N log N for
    * initial construction, log N for evaluations).  Avoid using this
    * function in any context where you are already looping over
-   * elements.
+   * elements.  To evaluate the solution at many points, or at the same
+   * points repeatedly, use a \p PointEvaluator, which keeps its point
+   * locator and \p FE objects between calls.
    *
    * Because the element containing \p p may lie on any processor,
    * this function is parallel-only.
@@ -0,0 +1,156 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2014 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_DISTRIBUTED_POINT_LOCATOR_H
+#define LIBMESH_DISTRIBUTED_POINT_LOCATOR_H
+
+// Local Includes
+#include "libmesh/auto_ptr.h"
+#include "libmesh/id_types.h"
+#include "libmesh/mesh_tools.h"
+#include "libmesh/parallel_object.h"
+#include "libmesh/point.h"
+
+// C++ includes
+#include <set>
+#include <vector>
+
+namespace libMesh
+{
+
+
+// Forward Declarations
+class MeshBase;
+class PointLocatorBase;
+
+
+/**
+ * This class locates points in a mesh which may be distributed, as a
+ * \p ParallelMesh is, so that no processor knows about the elements
+ * containing all the points.  Each processor only searches the
+ * elements it owns, with a \p PointLocatorTree of type
+ * \p TREE_LOCAL_ELEMENTS, and points are sent only to the processors
+ * whose elements' bounding box contains them.
+ *
+ * Every processor may ask for the location of different points.  For
+ * each point it gets back the id of the element containing it, the
+ * processor owning that element, and the point's location on the
+ * reference element, which is all that is needed to evaluate a
+ * solution there on the owning processor, e.g. for probes or for
+ * transferring solutions between meshes, without serializing the
+ * mesh.
+ *
+ * \p init() and \p locate_points() are collective.  Like the other
+ * locators this one has to be cleared and re-initialized whenever
+ * the mesh changes.
+ */
+class DistributedPointLocator : public ParallelObject
+{
+public:
+  /**
+   * Constructor.  Needs the \p mesh in which the points should be
+   * located.
+   */
+  explicit
+  DistributedPointLocator (const MeshBase& mesh);
+
+  /**
+   * Destructor.
+   */
+  ~DistributedPointLocator ();
+
+  /**
+   * Clears the locator.
+   */
+  void clear ();
+
+  /**
+   * Builds the local locator and exchanges the bounding boxes of the
+   * elements owned by each processor.  Collective.
+   */
+  void init ();
+
+  /**
+   * @returns \p true when this object is properly initialized
+   * and ready for use, \p false otherwise.
+   */
+  bool initialized () const;
+
+  /**
+   * Locates each of the \p points, which may differ from processor
+   * to processor.  On return \p elem_ids, \p processor_ids and
+   * \p reference_points hold, for each point, the id of the active
+   * element containing it, the processor owning that element and the
+   * location of the point on the reference element, or
+   * \p DofObject::invalid_id and \p DofObject::invalid_processor_id
+   * for points in no element.  A point on the boundary between
+   * elements of several processors is given to the lowest numbered
+   * of them.
+   *
+   * Optionally restricts the search to \p allowed_subdomains, which
+   * has to be the same on all processors.  Collective.
+   */
+  void locate_points (const std::vector<Point>& points,
+                      std::vector<dof_id_type>& elem_ids,
+                      std::vector<processor_id_type>& processor_ids,
+                      std::vector<Point>& reference_points,
+                      const std::set<subdomain_id_type> *allowed_subdomains = NULL) const;
+
+  /**
+   * @returns the bounding box of the elements owned by processor
+   * \p pid, slightly enlarged so that points on their boundary are
+   * inside it.  Empty for processors owning no elements.
+   */
+  const MeshTools::BoundingBox & processor_bounding_box (const processor_id_type pid) const;
+
+private:
+  /**
+   * Locates the \p points, which another processor or this one asked
+   * for, among the elements owned by this processor.
+   */
+  void locate_local_points (const std::vector<Point>& points,
+                            std::vector<dof_id_type>& elem_ids,
+                            std::vector<Point>& reference_points,
+                            const std::set<subdomain_id_type> *allowed_subdomains) const;
+
+  /**
+   * Constant reference to the mesh in which the points are located.
+   */
+  const MeshBase& _mesh;
+
+  /**
+   * The locator of the elements owned by this processor.
+   */
+  AutoPtr<PointLocatorBase> _local_locator;
+
+  /**
+   * The bounding boxes of the elements owned by each processor.
+   */
+  std::vector<MeshTools::BoundingBox> _processor_bboxes;
+
+  /**
+   * \p true when properly initialized, \p false otherwise.
+   */
+  bool _initialized;
+};
+
+
+} // namespace libMesh
+
+#endif // LIBMESH_DISTRIBUTED_POINT_LOCATOR_H
@@ -21,47 +21,156 @@
 #define LIBMESH_MAPVECTOR_H
 
 // C++ Includes   -----------------------------------
-#include <map>
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <vector>
 
 namespace libMesh
 {
 
 /**
  * This \p mapvector templated class is intended to provide the
- * performance characteristics of a std::map with an interface more
- * closely resembling that of a std::vector, for use with ParallelMesh.
+ * memory characteristics of a std::map (only the indices actually in
+ * use need storage) with the performance and interface of a
+ * std::vector, for use with ParallelMesh.
+ *
+ * Indices are grouped into chunks of \p chunk_size consecutive
+ * values.  A chunk with many entries is stored as a dense array, so
+ * that lookups are a single indexing operation; a chunk with only a
+ * few entries (e.g. ghost objects owned by another processor) is
+ * stored as a short sorted vector of indices with a matching vector
+ * of values instead.  Sparse chunks are converted to dense arrays as
+ * they fill up.  Either way the values of each chunk are contiguous,
+ * and \p next_block() gives direct access to them.
+ * Iteration visits the entries in index order, skipping the ones
+ * whose value is \p Val(); \p Val is therefore meant to be a pointer
+ * type, with \p NULL marking an empty entry.
+ *
+ * Iterators are index-based, so like std::map iterators they remain
+ * valid when other entries are inserted or erased.
  *
  * \author  Roy H. Stogner
  */
 
 template <typename Val, typename index_t=unsigned int>
-class mapvector : public std::map<index_t, Val>
+class mapvector
 {
 public:
-  typedef std::map<index_t, Val> maptype;
 
+  /**
+   * The number of consecutive indices stored together in a chunk.
+   */
+  static const index_t chunk_bits = 8;
+  static const index_t chunk_size = static_cast<index_t>(1) << chunk_bits;
+
+  /**
+   * Sparse chunks with more entries than this are made dense.
+   */
+  static const std::size_t max_sparse_size = chunk_size / 8;
+
+  /**
+   * The index used to mark the past-the-end iterator.  It may not be
+   * used as a key.
+   */
+  static const index_t end_index = static_cast<index_t>(-1);
+
+  mapvector () {}
+
+  mapvector (const mapvector &other)
+  {
+    *this = other;
+  }
+
+  mapvector & operator= (const mapvector &other)
+  {
+    if (this != &other)
+      {
+        this->clear();
+        for (index_t i = other.next_index(0, true); i != end_index;
+             i = other.next_index(i))
+          (*this)[i] = other[i];
+      }
+    return *this;
+  }
+
+  ~mapvector ()
+  {
+    this->clear();
+  }
+
+  /**
+   * @returns a writeable reference to the entry for \p k, creating an
+   * empty (\p Val()) entry first if necessary.
+   */
   Val& operator[] (const index_t &k)
   {
-    return maptype::operator[](k);
+    const std::size_t c = k >> chunk_bits;
+    if (c >= _chunks.size())
+      _chunks.resize(c+1);
+
+    chunk &ch = _chunks[c];
+    if (ch.dense)
+      return ch.dense[k & (chunk_size-1)];
+
+    if (!ch.sparse)
+      ch.sparse = new sparse_chunk;
+
+    const std::size_t j = ch.sparse->find(k);
+    if (j != ch.sparse->keys.size() && ch.sparse->keys[j] == k)
+      return ch.sparse->vals[j];
+
+    if (ch.sparse->keys.size() < max_sparse_size)
+      {
+        ch.sparse->keys.insert(ch.sparse->keys.begin() + j, k);
+        return *ch.sparse->vals.insert(ch.sparse->vals.begin() + j, Val());
+      }
+
+    // This chunk is filling up; switch it to dense storage
+    ch.make_dense();
+    return ch.dense[k & (chunk_size-1)];
   }
+
+  /**
+   * @returns the entry for \p k, or \p Val() if there is none.
+   */
   Val operator[] (const index_t &k) const
   {
-    typename maptype::const_iterator it = this->find(k);
-    return it == this->end().it? Val() : it->second;
+    const std::size_t c = k >> chunk_bits;
+    if (c >= _chunks.size())
+      return Val();
+
+    const chunk &ch = _chunks[c];
+    if (ch.dense)
+      return ch.dense[k & (chunk_size-1)];
+
+    if (ch.sparse)
+      {
+        const std::size_t j = ch.sparse->find(k);
+        if (j != ch.sparse->keys.size() && ch.sparse->keys[j] == k)
+          return ch.sparse->vals[j];
+      }
+
+    return Val();
+  }
+
+  /**
+   * @returns 1 if there is a non-empty entry for \p k, 0 otherwise.
+   */
+  std::size_t count (const index_t &k) const
+  {
+    return (*this)[k] != Val();
   }
 
   class veclike_iterator
   {
   public:
-    veclike_iterator(const typename maptype::iterator &i)
-      : it(i) {}
-
-    veclike_iterator(const veclike_iterator &i)
-      : it(i.it) {}
+    veclike_iterator(mapvector *m, index_t i)
+      : _m(m), _i(i) {}
 
-    Val& operator*() const { return it->second; }
+    Val& operator*() const { return (*_m)[_i]; }
 
-    veclike_iterator& operator++() { ++it; return *this; }
+    veclike_iterator& operator++() { _i = _m->next_index(_i); return *this; }
 
     veclike_iterator operator++(int) {
       veclike_iterator i = *this;
@@ -70,72 +179,324 @@ public:
     }
 
     bool operator==(const veclike_iterator &other) const {
-      return it == other.it;
+      return _i == other._i;
     }
 
     bool operator!=(const veclike_iterator &other) const {
-      return it != other.it;
+      return _i != other._i;
     }
 
-    typename maptype::iterator it;
+    /**
+     * @returns the index of the current entry.
+     */
+    index_t index() const { return _i; }
+
+  private:
+    friend class const_veclike_iterator;
+
+    mapvector *_m;
+    index_t _i;
   };
 
   class const_veclike_iterator
   {
   public:
-    const_veclike_iterator(const typename maptype::const_iterator &i)
-      : it(i) {}
-
-    const_veclike_iterator(const const_veclike_iterator &i)
-      : it(i.it) {}
+    const_veclike_iterator(const mapvector *m, index_t i)
+      : _m(m), _i(i), _val((*m)[i]) {}
 
     const_veclike_iterator(const veclike_iterator &i)
-      : it(i.it) {}
+      : _m(i._m), _i(i._i), _val((*_m)[_i]) {}
 
-    const Val& operator*() const { return it->second; }
+    const Val& operator*() const { return _val; }
 
-    const_veclike_iterator& operator++() { ++it; return *this; }
+    const_veclike_iterator& operator++() {
+      _i = _m->next_index(_i);
+      _val = (*_m)[_i];
+      return *this;
+    }
 
     const_veclike_iterator operator++(int) {
-      veclike_iterator i = *this;
+      const_veclike_iterator i = *this;
       ++(*this);
       return i;
     }
 
     bool operator==(const const_veclike_iterator &other) const {
-      return it == other.it;
+      return _i == other._i;
     }
 
     bool operator!=(const const_veclike_iterator &other) const {
-      return it != other.it;
+      return _i != other._i;
     }
 
-    typename maptype::const_iterator it;
+    /**
+     * @returns the index of the current entry.
+     */
+    index_t index() const { return _i; }
+
+  private:
+    const mapvector *_m;
+    index_t _i;
+
+    // The const operator[] returns by value, so we keep a copy to
+    // hand out references to.
+    Val _val;
   };
 
+  /**
+   * Removes the entry for \p i, if any.
+   */
   void erase(index_t i) {
-    maptype::erase(i);
+    const std::size_t c = i >> chunk_bits;
+    if (c >= _chunks.size())
+      return;
+
+    chunk &ch = _chunks[c];
+    if (ch.dense)
+      ch.dense[i & (chunk_size-1)] = Val();
+    else if (ch.sparse)
+      {
+        const std::size_t j = ch.sparse->find(i);
+        if (j != ch.sparse->keys.size() && ch.sparse->keys[j] == i)
+          {
+            ch.sparse->keys.erase(ch.sparse->keys.begin() + j);
+            ch.sparse->vals.erase(ch.sparse->vals.begin() + j);
+          }
+      }
   }
 
   void erase(const veclike_iterator &pos) {
-    maptype::erase(pos.it);
+    this->erase(pos.index());
+  }
+
+  /**
+   * Removes all entries and frees all storage.
+   */
+  void clear() {
+    for (std::size_t c = 0; c != _chunks.size(); ++c)
+      _chunks[c].release();
+    _chunks.clear();
+  }
+
+  /**
+   * Frees the storage used by empty (\p Val()) entries: sparse
+   * chunks drop their empty entries, and dense chunks with no
+   * entries left are deallocated.
+   */
+  void compact() {
+    for (std::size_t c = 0; c != _chunks.size(); ++c)
+      {
+        chunk &ch = _chunks[c];
+        if (ch.dense)
+          {
+            bool in_use = false;
+            for (index_t j = 0; j != chunk_size; ++j)
+              if (ch.dense[j] != Val())
+                {
+                  in_use = true;
+                  break;
+                }
+            if (!in_use)
+              ch.release();
+          }
+        else if (ch.sparse)
+          {
+            std::vector<index_t> &keys = ch.sparse->keys;
+            std::vector<Val> &vals = ch.sparse->vals;
+            std::size_t n = 0;
+            for (std::size_t j = 0; j != keys.size(); ++j)
+              if (vals[j] != Val())
+                {
+                  keys[n] = keys[j];
+                  vals[n] = vals[j];
+                  ++n;
+                }
+            keys.resize(n);
+            vals.resize(n);
+            if (keys.empty())
+              ch.release();
+          }
+      }
+
+    // Trim trailing empty chunks from the directory
+    std::size_t n_chunks = _chunks.size();
+    while (n_chunks && !_chunks[n_chunks-1].dense && !_chunks[n_chunks-1].sparse)
+      --n_chunks;
+    _chunks.resize(n_chunks);
+  }
+
+  /**
+   * @returns true if there are no non-empty entries.
+   */
+  bool empty() const {
+    return this->next_index(0, true) == end_index;
+  }
+
+  /**
+   * @returns the largest index with a non-empty entry, or \p
+   * end_index if there is none.
+   */
+  index_t max_index() const {
+    for (std::size_t c = _chunks.size(); c != 0; --c)
+      {
+        const chunk &ch = _chunks[c-1];
+        if (ch.dense)
+          {
+            for (index_t j = chunk_size; j != 0; --j)
+              if (ch.dense[j-1] != Val())
+                return static_cast<index_t>(((c-1) << chunk_bits) + (j-1));
+          }
+        else if (ch.sparse)
+          {
+            for (std::size_t j = ch.sparse->keys.size(); j != 0; --j)
+              if (ch.sparse->vals[j-1] != Val())
+                return ch.sparse->keys[j-1];
+          }
+      }
+    return end_index;
+  }
+
+  /**
+   * Gives access to the values of the container one contiguous block
+   * at a time, in index order.  Start with \p block set to 0; each
+   * call sets [\p first, \p last) to the values of the next non-empty
+   * block and returns true, or returns false when there are no more
+   * blocks.  The blocks may contain empty (\p Val()) entries.
+   */
+  bool next_block (std::size_t &block, const Val * &first, const Val * &last) const
+  {
+    for (; block < _chunks.size(); ++block)
+      {
+        const chunk &ch = _chunks[block];
+        if (ch.dense)
+          {
+            first = ch.dense;
+            last = ch.dense + chunk_size;
+            ++block;
+            return true;
+          }
+        if (ch.sparse && !ch.sparse->vals.empty())
+          {
+            first = &ch.sparse->vals[0];
+            last = first + ch.sparse->vals.size();
+            ++block;
+            return true;
+          }
+      }
+    return false;
   }
 
   veclike_iterator begin() {
-    return veclike_iterator(maptype::begin());
+    return veclike_iterator(this, this->next_index(0, true));
   }
 
   const_veclike_iterator begin() const {
-    return const_veclike_iterator(maptype::begin());
+    return const_veclike_iterator(this, this->next_index(0, true));
   }
 
   veclike_iterator end() {
-    return veclike_iterator(maptype::end());
+    return veclike_iterator(this, end_index);
   }
 
   const_veclike_iterator end() const {
-    return const_veclike_iterator(maptype::end());
+    return const_veclike_iterator(this, end_index);
   }
+
+private:
+
+  /**
+   * The entries of a sparse chunk: sorted indices, and their values.
+   */
+  struct sparse_chunk
+  {
+    std::vector<index_t> keys;
+    std::vector<Val> vals;
+
+    /**
+     * @returns the position of the first key not less than \p k.
+     */
+    std::size_t find (const index_t k) const
+    {
+      return std::lower_bound(keys.begin(), keys.end(), k) - keys.begin();
+    }
+  };
+
+  /**
+   * The storage for chunk_size consecutive indices: either a dense
+   * array, a sorted vector of the entries in use, or nothing.
+   */
+  struct chunk
+  {
+    chunk () : dense(NULL), sparse(NULL) {}
+
+    void make_dense ()
+    {
+      dense = new Val[chunk_size];
+      std::fill(dense, dense + chunk_size, Val());
+      if (sparse)
+        {
+          for (std::size_t j = 0; j != sparse->keys.size(); ++j)
+            dense[sparse->keys[j] & (chunk_size-1)] = sparse->vals[j];
+          delete sparse;
+          sparse = NULL;
+        }
+    }
+
+    void release ()
+    {
+      delete [] dense;
+      dense = NULL;
+      delete sparse;
+      sparse = NULL;
+    }
+
+    Val * dense;
+    sparse_chunk * sparse;
+  };
+
+  /**
+   * @returns the first index with a non-empty entry which is greater
+   * than \p i (or not less than \p i, if \p inclusive), or \p
+   * end_index if there is none.
+   */
+  index_t next_index (index_t i, bool inclusive = false) const
+  {
+    if (!inclusive)
+      {
+        if (i == end_index)
+          return end_index;
+        ++i;
+      }
+
+    std::size_t c = i >> chunk_bits;
+    index_t j = i & (chunk_size-1);
+    for (; c < _chunks.size(); ++c, j = 0)
+      {
+        const chunk &ch = _chunks[c];
+        if (ch.dense)
+          {
+            for (; j != chunk_size; ++j)
+              if (ch.dense[j] != Val())
+                return static_cast<index_t>((c << chunk_bits) + j);
+          }
+        else if (ch.sparse)
+          {
+            const index_t first = static_cast<index_t>((c << chunk_bits) + j);
+            for (std::size_t k = ch.sparse->find(first);
+                 k != ch.sparse->keys.size(); ++k)
+              if (ch.sparse->vals[k] != Val())
+                return ch.sparse->keys[k];
+          }
+      }
+
+    return end_index;
+  }
+
+  /**
+   * The chunk directory; chunk \p c holds the indices from
+   * c*chunk_size to (c+1)*chunk_size-1.
+   */
+  std::vector<chunk> _chunks;
 };
 
 } // namespace libMesh
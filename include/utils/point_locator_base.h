@@ -96,6 +96,52 @@ public:
    */
   virtual const Elem* operator() (const Point& p, const std::set<subdomain_id_type> *allowed_subdomains = NULL) const = 0;
 
+  /**
+   * Locates many points at once: on return \p elems[i] is the element
+   * containing \p points[i], or \p NULL if none was found, and
+   * \p reference_points[i] is the location of \p points[i] on that
+   * element's reference element.  Optionally allows the user to
+   * restrict the subdomains searched.
+   *
+   * The points are visited in order along a space-filling curve, and
+   * each search starts by walking from the element the previous point
+   * was found in across element neighbors, so that points which are
+   * close together, like those of a probe line or of another mesh,
+   * rarely need a full search.  The points are split among threads.
+   */
+  void locate_points (const std::vector<Point>& points,
+                      std::vector<const Elem*>& elems,
+                      std::vector<Point>& reference_points,
+                      const std::set<subdomain_id_type> *allowed_subdomains = NULL) const;
+
+  /**
+   * Locates the element in which the point with global coordinates
+   * \p p is located, using \p hint, e.g. the element the point was
+   * in at the previous time step, as a starting guess: \p hint is
+   * checked first, then the neighbors of elements are walked towards
+   * \p p (see \p walk()), and only if that fails is \p p searched
+   * for by \p operator().  \p hint may be \p NULL.  Optionally allows
+   * the user to restrict the subdomains searched.
+   */
+  const Elem* locate_from (const Point& p,
+                           const Elem* hint,
+                           const std::set<subdomain_id_type> *allowed_subdomains = NULL) const;
+
+  /**
+   * Enables neighbor walking mode.  In this mode \p operator() uses
+   * the element it found last as a hint, as in \p locate_from(),
+   * instead of only checking whether it contains the new point.
+   * This pays off when successive points are in the same or nearby
+   * elements, as when tracking particles.  Per default, this mode is
+   * off.
+   */
+  void enable_neighbor_walking ();
+
+  /**
+   * Disables neighbor walking mode (default).
+   */
+  void disable_neighbor_walking ();
+
   /**
    * @returns \p true when this object is properly initialized
    * and ready for use, \p false otherwise.
@@ -117,6 +163,15 @@ public:
    */
   virtual void disable_out_of_mesh_mode () = 0;
 
+  /**
+   * Recomputes whatever the locator caches of the element positions
+   * after nodes of the mesh have moved, without rebuilding it, so
+   * that its servants remain valid.  Call it on the master locator,
+   * whose search structure its servants share; it is not
+   * thread-safe.  Pure virtual.
+   */
+  virtual void update_element_boxes () = 0;
+
   /**
    * Set a tolerance to use when determining
    * if a point is contained within the mesh.
@@ -130,6 +185,46 @@ public:
   virtual void unset_close_to_point_tol();
 
 protected:
+  /**
+   * Locates the element in which the point \p p is located, like
+   * \p operator(), but without using or changing any state of this
+   * object, so that several threads may call it at once.  The
+   * default implementation serializes calls to \p operator().
+   */
+  virtual const Elem* find_element (const Point& p,
+                                    const std::set<subdomain_id_type> *allowed_subdomains) const;
+
+  /**
+   * Walks across element neighbors from \p start towards the point
+   * \p p, leaving each element through the side its reference
+   * coordinates show \p p to lie beyond.  Returns the element
+   * containing \p p, and sets \p reference_point to its location on
+   * the reference element, or returns \p NULL if the walk reaches
+   * the boundary, a refined or remote neighbor or an unsupported
+   * element type, takes too many steps, or ends in an element
+   * outside \p allowed_subdomains or outside those this locator
+   * searches (see \p searches()).
+   */
+  const Elem* walk (const Point& p,
+                    const Elem* start,
+                    const std::set<subdomain_id_type> *allowed_subdomains,
+                    Point& reference_point) const;
+
+  /**
+   * @returns \p true if \p elem is among the elements this locator
+   * searches.  A walk across neighbors may reach elements which the
+   * search structure leaves out, e.g. those of other processors, and
+   * \p walk() does not return those.  The default accepts any
+   * element.
+   */
+  virtual bool searches (const Elem* /*elem*/) const { return true; }
+
+  /**
+   * The function object used by \p locate_points() to locate a range
+   * of points.  Defined in the source file.
+   */
+  class LocatePoints;
+
   /**
    * Const pointer to our master, initialized to \p NULL if none
    * given.  When using multiple PointLocators, one can be assigned
@@ -157,6 +252,12 @@ protected:
    * The tolerance to use.
    */
   Real _close_to_point_tol;
+
+  /**
+   * \p true if neighbor walking mode is enabled.  See \p
+   * enable_neighbor_walking() for details.
+   */
+  bool _walk_neighbors;
 };
 
 } // namespace libMesh
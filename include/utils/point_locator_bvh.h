@@ -0,0 +1,167 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2014 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_POINT_LOCATOR_BVH_H
+#define LIBMESH_POINT_LOCATOR_BVH_H
+
+// Local Includes
+#include "libmesh/point_locator_base.h"
+
+// C++ includes
+#include <cstddef>
+
+namespace libMesh
+{
+
+
+// Forward Declarations
+class MeshBase;
+class Point;
+class Elem;
+
+
+/**
+ * This is a point locator.  It locates points in space using a
+ * bounding volume hierarchy: a tree whose leaves are the bounding
+ * boxes of the active elements, computed once when the locator is
+ * initialized, and whose inner nodes bound their children.
+ *
+ * Unlike the octree used by \p PointLocatorTree, which bins elements
+ * by region and then calls \p Elem::contains_point() on every element
+ * of a bin, only elements whose box contains the point are tested.
+ * The hierarchy is stored in one flat array, and each of its nodes
+ * holds the boxes of its four children coordinate by coordinate, so
+ * that all four are tested at once with a branch-free loop the
+ * compiler can vectorize.
+ *
+ * Use \p PointLocatorBase::build() with the \p BVH type, or
+ * \p MeshBase::set_point_locator_type(), to create objects of this
+ * type at run time.  Like the other locators it has to be cleared
+ * and re-initialized whenever elements are added or removed; after
+ * nodes move, \p update_element_boxes() is enough.
+ */
+class PointLocatorBVH : public PointLocatorBase
+{
+public:
+  /**
+   * Constructor.  Needs the \p mesh in which the points should be
+   * located.  Optionally takes a master locator: only the master
+   * holds a hierarchy, the others simply use the master's.
+   */
+  PointLocatorBVH (const MeshBase& mesh,
+                   const PointLocatorBase* master = NULL);
+
+  /**
+   * Destructor.
+   */
+  ~PointLocatorBVH ();
+
+  /**
+   * Clears the locator.  This function frees dynamic memory with "delete".
+   */
+  virtual void clear();
+
+  /**
+   * Initializes the locator, so that the \p operator() methods can
+   * be used.  This function allocates dynamic memory with "new".
+   */
+  virtual void init();
+
+  /**
+   * Locates the element in which the point with global coordinates
+   * \p p is located, optionally restricted to a set of allowed
+   * subdomains.  The element found by the previous call is checked
+   * first.
+   */
+  virtual const Elem* operator() (const Point& p, const std::set<subdomain_id_type> *allowed_subdomains = NULL) const;
+
+  /**
+   * Enables out-of-mesh mode.  In this mode, if asked to find a point
+   * that is contained in no mesh at all, the point locator will
+   * return a NULL pointer instead of crashing.  Per default, this
+   * mode is off.
+   */
+  virtual void enable_out_of_mesh_mode ();
+
+  /**
+   * Disables out-of-mesh mode (default).  If asked to find a point
+   * that is contained in no mesh at all, the point locator will now
+   * crash.
+   */
+  virtual void disable_out_of_mesh_mode ();
+
+  /**
+   * Refits the hierarchy after nodes of the mesh have moved, without
+   * rebuilding it: the boxes of the elements and of the nodes above
+   * them are recomputed.  The hierarchy stays valid after any
+   * motion, but the boxes of its nodes overlap more the further the
+   * elements have moved from where it was built.
+   */
+  virtual void update_element_boxes ();
+
+protected:
+  /**
+   * The nodes of the hierarchy and the elements they lead to.
+   * Defined in the source file.
+   */
+  struct Hierarchy;
+
+  /**
+   * Searches the hierarchy, and if necessary does a linear search,
+   * for the element containing \p p, without touching \p _element.
+   */
+  virtual const Elem* find_element (const Point& p,
+                                    const std::set<subdomain_id_type> *allowed_subdomains) const;
+
+  /**
+   * Walks the hierarchy, testing every element whose box comes
+   * within \p radius of \p p in each coordinate direction.  Elements
+   * are tested with \p Elem::contains_point(), or with
+   * \p Elem::close_to_point() if \p close_to_point_tol is positive.
+   * Returns the first element that passes, or \p NULL.
+   */
+  const Elem* search (const Point& p,
+                      const Real radius,
+                      const std::set<subdomain_id_type> *allowed_subdomains,
+                      const Real close_to_point_tol) const;
+
+  /**
+   * Pointer to our hierarchy.  It is built at run-time through
+   * \p init().  For servant PointLocators (not master), this
+   * simply points to the hierarchy of the master.
+   */
+  Hierarchy* _bvh;
+
+  /**
+   * Pointer to the last element that was found.  Chances are that
+   * this may be close to the next call to \p operator()...
+   */
+  mutable const Elem* _element;
+
+  /**
+   * \p true if out-of-mesh mode is enabled.  See \p
+   * enable_out_of_mesh_mode() for details.
+   */
+  bool _out_of_mesh_mode;
+};
+
+
+} // namespace libMesh
+
+#endif // LIBMESH_POINT_LOCATOR_BVH_H
@@ -118,6 +118,12 @@ public:
    */
   virtual void disable_out_of_mesh_mode ();
 
+  /**
+   * Recomputes the element centroids in the list after nodes of the
+   * mesh have moved.
+   */
+  virtual void update_element_boxes ();
+
   /**
    * Set a tolerance to use when determining
    * if a point is contained within the mesh.
@@ -136,7 +136,31 @@ public:
    */
   virtual void disable_out_of_mesh_mode ();
 
+  /**
+   * Updates the tree after nodes of the mesh have moved, e.g. in a
+   * mesh-moving simulation, without rebuilding it.  The bounding
+   * boxes of the elements and of the tree nodes are recomputed, but
+   * elements stay in the bins they were inserted in, so after
+   * motions of more than a fraction of an element the bins overlap
+   * and searches slow down; rebuild the locator then, once no
+   * servants are in use.
+   */
+  virtual void update_element_boxes ();
+
 protected:
+  /**
+   * Asks the tree, and if necessary does a linear search, for the
+   * element containing \p p, without touching \p _element.
+   */
+  virtual const Elem* find_element (const Point& p,
+                                    const std::set<subdomain_id_type> *allowed_subdomains) const;
+
+  /**
+   * @returns \p false for elements of other processors if only the
+   * local elements are in our tree.
+   */
+  virtual bool searches (const Elem* elem) const;
+
   /**
    * Pointer to our tree.  The tree is built at run-time
    * through \p init().  For servant PointLocators (not master),
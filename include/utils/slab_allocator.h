@@ -0,0 +1,97 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2014 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_SLAB_ALLOCATOR_H
+#define LIBMESH_SLAB_ALLOCATOR_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <cstddef>
+
+namespace libMesh
+{
+
+/**
+ * The \p SlabAllocator hands out memory for small objects, such as
+ * \p Elem and \p Node objects, from large slabs.  Objects of each size
+ * (rounded up to a multiple of \p granularity bytes) come from their
+ * own slabs, so that the elements of a given type sit next to each
+ * other in memory, and allocating or freeing an object only pushes
+ * or pops a free list instead of calling \p malloc.
+ *
+ * Each slab counts its live objects, and is returned to the system
+ * as soon as its last object is freed; only one empty slab per
+ * object size is kept back for reuse, until \p release_memory().
+ * Each thread keeps a short free list per object size of its own,
+ * so that threads creating elements at once rarely contend for the
+ * shared slabs.  Up to a few dozen freed objects per size may sit in
+ * each thread's list, keeping their slabs alive, until the thread
+ * exits or calls \p release_memory().
+ *
+ * All functions are thread-safe.
+ */
+class SlabAllocator
+{
+public:
+
+  /**
+   * Objects are handed out in multiples of this many bytes, which
+   * keeps them suitably aligned for any of their members.
+   */
+  static const std::size_t granularity = 16;
+
+  /**
+   * Objects larger than this are allocated with \p operator \p new.
+   */
+  static const std::size_t max_object_size = 1024;
+
+  /**
+   * The size of each slab, in bytes.
+   */
+  static const std::size_t slab_size = 256*1024;
+
+  /**
+   * @returns memory for an object of \p size bytes.
+   */
+  static void* allocate (std::size_t size);
+
+  /**
+   * Returns the memory at \p p, which must have been obtained from
+   * \p allocate(size), to the allocator.
+   */
+  static void deallocate (void* p, std::size_t size);
+
+  /**
+   * Hands the objects in the calling thread's free lists back to
+   * their slabs, and frees every slab left without live objects.
+   * Returns true if at least one slab was freed.
+   */
+  static bool release_memory ();
+
+  /**
+   * @returns the number of bytes currently held in slabs.
+   */
+  static std::size_t n_slab_bytes ();
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_SLAB_ALLOCATOR_H
@@ -0,0 +1,294 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2014 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_SMALL_VECTOR_H
+#define LIBMESH_SMALL_VECTOR_H
+
+// C++ Includes   -----------------------------------
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+// libMesh includes
+#include "libmesh/libmesh_common.h"
+
+namespace libMesh
+{
+
+/**
+ * This \p small_vector templated class provides the subset of the
+ * std::vector interface needed by \p DofObject, but stores up to \p N
+ * entries inline in the object itself.  Only larger vectors are
+ * allocated on the heap.  This saves both the memory and the extra
+ * indirection of a heap buffer for the many small vectors of a mesh.
+ *
+ * \p T must be a plain-old-data type; entries are copied with
+ * std::copy and are not constructed or destroyed individually.
+ * Iterators are plain pointers, which are invalidated by any
+ * operation that changes the size or capacity of the vector.
+ */
+template <typename T, unsigned int N>
+class small_vector
+{
+public:
+  typedef T              value_type;
+  typedef T*             iterator;
+  typedef const T*       const_iterator;
+  typedef T&             reference;
+  typedef const T&       const_reference;
+  typedef std::size_t    size_type;
+
+  small_vector () :
+    _size(0),
+    _capacity(N)
+  {}
+
+  explicit
+  small_vector (size_type n, const T &val = T()) :
+    _size(0),
+    _capacity(N)
+  {
+    this->resize(n, val);
+  }
+
+  small_vector (const small_vector &other) :
+    _size(0),
+    _capacity(N)
+  {
+    this->assign(other.begin(), other.end());
+  }
+
+  ~small_vector ()
+  {
+    if (!this->is_inline())
+      delete [] _data.heap;
+  }
+
+  small_vector & operator= (const small_vector &other)
+  {
+    if (this != &other)
+      this->assign(other.begin(), other.end());
+    return *this;
+  }
+
+  size_type size () const { return _size; }
+
+  size_type capacity () const { return _capacity; }
+
+  bool empty () const { return _size == 0; }
+
+  T * data () { return this->is_inline() ? _data.local : _data.heap; }
+
+  const T * data () const { return this->is_inline() ? _data.local : _data.heap; }
+
+  iterator begin () { return this->data(); }
+
+  const_iterator begin () const { return this->data(); }
+
+  iterator end () { return this->data() + _size; }
+
+  const_iterator end () const { return this->data() + _size; }
+
+  reference operator[] (size_type i)
+  {
+    libmesh_assert_less (i, _size);
+    return this->data()[i];
+  }
+
+  const_reference operator[] (size_type i) const
+  {
+    libmesh_assert_less (i, _size);
+    return this->data()[i];
+  }
+
+  /**
+   * Makes room for at least \p n entries.
+   */
+  void reserve (size_type n)
+  {
+    if (n > _capacity)
+      this->reallocate(n);
+  }
+
+  /**
+   * Moves the entries back into the inline storage if they fit, or
+   * into a heap buffer of exactly the right size otherwise.
+   */
+  void shrink_to_fit ()
+  {
+    if (_capacity > N && _capacity != _size)
+      this->reallocate(_size);
+  }
+
+  void clear () { _size = 0; }
+
+  void resize (size_type n, const T &val = T())
+  {
+    this->reserve(n);
+    if (n > _size)
+      std::fill(this->data() + _size, this->data() + n, val);
+    _size = cast_int<unsigned int>(n);
+  }
+
+  void push_back (const T &val)
+  {
+    if (_size == _capacity)
+      this->reallocate(2*_capacity);
+    this->data()[_size++] = val;
+  }
+
+  template <typename InputIterator>
+  void assign (InputIterator first, InputIterator last)
+  {
+    const size_type n = std::distance(first, last);
+    _size = 0;
+    this->reserve(n);
+    std::copy(first, last, this->data());
+    _size = cast_int<unsigned int>(n);
+  }
+
+  iterator insert (iterator pos, const T &val)
+  {
+    // Copy val first, in case it refers to one of our own entries
+    const T v = val;
+    const size_type i = pos - this->begin();
+    if (_size == _capacity)
+      this->reallocate(2*_capacity);
+    T * d = this->data();
+    std::copy_backward(d + i, d + _size, d + _size + 1);
+    d[i] = v;
+    ++_size;
+    return d + i;
+  }
+
+  template <typename InputIterator>
+  void insert (iterator pos, InputIterator first, InputIterator last)
+  {
+    const size_type i = pos - this->begin();
+    const size_type n = std::distance(first, last);
+    if (_size + n > _capacity)
+      this->reallocate(std::max(_size + n, size_type(2*_capacity)));
+    T * d = this->data();
+    std::copy_backward(d + i, d + _size, d + _size + n);
+    std::copy(first, last, d + i);
+    _size = cast_int<unsigned int>(_size + n);
+  }
+
+  iterator erase (iterator first, iterator last)
+  {
+    iterator new_end = std::copy(last, this->end(), first);
+    _size = cast_int<unsigned int>(new_end - this->begin());
+    return first;
+  }
+
+  void swap (small_vector &other)
+  {
+    if (!this->is_inline() && !other.is_inline())
+      {
+        std::swap(_data.heap, other._data.heap);
+        std::swap(_size, other._size);
+        std::swap(_capacity, other._capacity);
+      }
+    else
+      {
+        small_vector tmp;
+        tmp.take(*this);
+        this->take(other);
+        other.take(tmp);
+      }
+  }
+
+private:
+
+  bool is_inline () const { return _capacity == N; }
+
+  /**
+   * Moves the entries to storage with room for \p n entries, which
+   * is the inline storage when \p n is at most \p N.
+   */
+  void reallocate (size_type n)
+  {
+    libmesh_assert_greater_equal (n, _size);
+
+    if (n <= N)
+      {
+        if (!this->is_inline())
+          {
+            T * old = _data.heap;
+            std::copy(old, old + _size, _data.local);
+            delete [] old;
+            _capacity = N;
+          }
+        return;
+      }
+
+    T * new_heap = new T[n];
+    std::copy(this->begin(), this->end(), new_heap);
+    if (!this->is_inline())
+      delete [] _data.heap;
+    _data.heap = new_heap;
+    _capacity = cast_int<unsigned int>(n);
+  }
+
+  /**
+   * Moves the contents of \p other, which is left empty and inline,
+   * into this (empty) vector.
+   */
+  void take (small_vector &other)
+  {
+    if (!this->is_inline())
+      delete [] _data.heap;
+
+    if (other.is_inline())
+      {
+        std::copy(other.begin(), other.end(), _data.local);
+        _capacity = N;
+      }
+    else
+      {
+        _data.heap = other._data.heap;
+        _capacity = other._capacity;
+      }
+    _size = other._size;
+
+    other._size = 0;
+    other._capacity = N;
+  }
+
+  /**
+   * The entries, stored inline while there are at most \p N of them.
+   */
+  union
+  {
+    T local[N];
+    T * heap;
+  } _data;
+
+  unsigned int _size;
+
+  /**
+   * \p N when the entries are stored inline, the size of the heap
+   * buffer otherwise.
+   */
+  unsigned int _capacity;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_SMALL_VECTOR_H
@@ -0,0 +1,141 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2014 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+#ifndef LIBMESH_TOPOLOGY_MAP_H
+#define LIBMESH_TOPOLOGY_MAP_H
+
+#include "libmesh/libmesh_config.h"
+
+#ifdef LIBMESH_ENABLE_AMR
+
+// Local Includes -----------------------------------
+#include "libmesh/libmesh_common.h"
+
+// C++ Includes   -----------------------------------
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward Declarations -----------------------------
+class Elem;
+class MeshBase;
+class Node;
+
+
+/**
+ * Data structure that identifies the nodes created by refinement
+ * through the parent nodes they are interpolated from.  The key of
+ * a child node is the list of ids of the parent's nodes which have a
+ * nonzero weight in the embedding matrix, sorted, along with these
+ * weights.  The children of neighboring elements compute the same key
+ * for the nodes on their common side, so nodes are matched exactly,
+ * without any tolerance, and regardless of the mesh scaling.
+ *
+ * The keys are stored contiguously and indexed by a flat, linearly
+ * probed hash table.  find() does not modify the map, so it may be
+ * called from several threads at once.
+ */
+class TopologyMap
+{
+public:
+  TopologyMap();
+
+  /**
+   * Fills the map with the nodes of the children of every
+   * ancestor element in \p mesh.
+   */
+  void init(MeshBase& mesh);
+
+  void clear();
+
+  bool empty() const { return _n_entries == 0; }
+
+  /**
+   * Returns the node for node \p nc of child \p c of \p parent, or
+   * \p NULL if there is none in the map yet.
+   */
+  Node* find(const Elem& parent,
+             const unsigned int c,
+             const unsigned int nc) const;
+
+  /**
+   * Adds \p node as node \p nc of child \p c of \p parent.
+   */
+  void insert(const Elem& parent,
+              const unsigned int c,
+              const unsigned int nc,
+              Node& node);
+
+private:
+
+  /**
+   * A parent node id and its weight in the embedding matrix
+   */
+  typedef std::pair<dof_id_type, float> key_entry;
+
+  /**
+   * The largest number of nodes of any parent element
+   */
+  static const unsigned int max_key_length = 27;
+
+  /**
+   * Builds the key of node \p nc of child \p c of \p parent in \p key,
+   * and returns its length.  The length is zero for nodes of the
+   * parent itself, which are never stored.
+   */
+  static unsigned int build_key(const Elem& parent,
+                                const unsigned int c,
+                                const unsigned int nc,
+                                key_entry* key);
+
+  static std::size_t hash(const key_entry* key,
+                          const unsigned int length);
+
+  /**
+   * Returns the slot holding \p key, or the empty slot it would go in.
+   */
+  std::size_t slot_of(const key_entry* key,
+                      const unsigned int length,
+                      const std::size_t h) const;
+
+  /**
+   * Doubles the number of slots and rehashes the keys.
+   */
+  void grow();
+
+  struct Slot
+  {
+    std::size_t hash;
+    std::size_t key_begin;
+    unsigned int key_length;
+    Node* node;
+  };
+
+  std::vector<Slot>      _slots;
+  std::vector<key_entry> _keys;
+  std::size_t            _n_entries;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_ENABLE_AMR
+
+#endif // LIBMESH_TOPOLOGY_MAP_H
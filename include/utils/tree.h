@@ -74,6 +74,12 @@ public:
    */
   unsigned int n_active_bins() const { return root.n_active_bins(); }
 
+  /**
+   * Recomputes the cached bounding boxes of the elements and of the
+   * tree nodes.
+   */
+  void update_element_boxes();
+
   /**
    * @returns a pointer to the element containing point p,
    * optionally restricted to a set of allowed subdomains.
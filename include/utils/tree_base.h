@@ -88,6 +88,14 @@ public:
    */
   virtual unsigned int n_active_bins() const = 0;
 
+  /**
+   * Recomputes the bounding boxes of the elements, which are cached
+   * to reject points quickly, after nodes of the mesh have moved.
+   * The elements stay in the bins they were put in, so after larger
+   * motions the tree has to be rebuilt instead.
+   */
+  virtual void update_element_boxes() = 0;
+
   /**
    * @returns a pointer to the element containing point p,
    * optionally restricted to a set of allowed subdomains.
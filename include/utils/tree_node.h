@@ -34,6 +34,7 @@ namespace libMesh
 
 // Forward Declarations
 class MeshBase;
+class MeshAdjacency;
 class Node;
 class Elem;
 
@@ -128,7 +129,7 @@ public:
   /**
    * Transforms node numbers to element pointers.
    */
-  void transform_nodes_to_elements (std::vector<std::vector<const Elem*> >& nodes_to_elem);
+  void transform_nodes_to_elements (const MeshAdjacency& adjacency);
 
   /**
    * @returns the number of active bins below
@@ -136,6 +137,16 @@ public:
    */
   unsigned int n_active_bins() const;
 
+  /**
+   * Recomputes the bounding boxes of the elements in the active
+   * nodes, which \p find_element() tests points against before
+   * calling \p Elem::contains_point(), and shrinks or grows the
+   * bounding box of each tree node to those of the elements below
+   * it.  Has to be called once the elements are in place, and again
+   * whenever nodes move.
+   */
+  void update_element_boxes ();
+
   /**
    * @returns an element containing point p,
    * optionally restricted to a set of allowed subdomains.
@@ -183,6 +194,15 @@ private:
    */
   std::vector<const Elem*> elements;
 
+  /**
+   * The bounding boxes of \p elements, enlarged as
+   * \p Elem::contains_point() enlarges them, or covering all of
+   * space for elements which may not lie within the bounding box of
+   * their nodes.  Points outside of them are rejected with a few
+   * comparisons, without touching the elements.
+   */
+  std::vector<std::pair<Point, Point> > element_boxes;
+
   /**
    * The node numbers contained in this portion of the tree.
    */
@@ -0,0 +1,540 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2014 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_VECTORMULTIMAP_H
+#define LIBMESH_VECTORMULTIMAP_H
+
+// C++ Includes   -----------------------------------
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+// libMesh includes
+#include "libmesh/libmesh_common.h"
+
+
+namespace libMesh
+{
+
+/**
+ * This \p vectormultimap templated class stores (key, value) pairs in
+ * a sorted std::vector, with an interface resembling that of a
+ * std::multimap.  Like \p vectormap it is meant for use when memory
+ * is tight: each entry costs the size of the pair plus one bit,
+ * instead of the three pointers and color of a tree node, and
+ * lookups are binary searches over contiguous memory.
+ *
+ * Several values may be stored for one key, and are kept in the
+ * order they were inserted.  A (key, value) pair which is already
+ * stored is only stored once.
+ *
+ * Insertions which keep the vector sorted, i.e. those in key order,
+ * cost a binary search.  Others are appended to an unsorted tail,
+ * which lookups scan after their binary search.  The tail is merged
+ * in by \p sort(), and also automatically once it grows past the
+ * square root of the size, so that it stays short enough to scan
+ * while out-of-order insertions cost O(sqrt(n)) each, amortized.
+ * The efficient use is still to do many insertions and then call
+ * \p sort(), as with \p vectormap.  Erased entries are only flagged,
+ * and are skipped by lookups until a merge removes them, so that
+ * erasures may be freely interleaved with lookups, and do not
+ * invalidate iterators.
+ *
+ * Lookups never modify the container, so several threads may do
+ * them at once; as with other containers, insertions, erasures and
+ * \p sort() must not race with anything else.
+ */
+template <typename Key, typename Tp>
+class vectormultimap
+{
+public:
+
+  typedef Key                       key_type;
+  typedef Tp                        mapped_type;
+  typedef std::pair<Key, Tp>        value_type;
+  typedef std::vector<value_type>   vector_type;
+  typedef std::ptrdiff_t            difference_type;
+
+  /**
+   * Iterator over the entries, skipping erased ones.  Entries are
+   * visited in key order, except for those in the unsorted tail,
+   * which come last.
+   */
+  class const_iterator
+  {
+  public:
+
+    typedef std::forward_iterator_tag iterator_category;
+    typedef std::pair<Key, Tp>        value_type;
+    typedef std::ptrdiff_t            difference_type;
+    typedef const value_type*         pointer;
+    typedef const value_type&         reference;
+
+    const_iterator () : _map(NULL), _i(0), _sorted_end(0), _keyed(false) {}
+
+    const value_type & operator* () const { return _map->_vals[_i]; }
+
+    const value_type * operator-> () const { return &_map->_vals[_i]; }
+
+    const_iterator & operator++ ()
+    {
+      ++_i;
+      this->skip();
+      return *this;
+    }
+
+    const_iterator operator++ (int)
+    {
+      const_iterator i = *this;
+      ++(*this);
+      return i;
+    }
+
+    bool operator== (const const_iterator &other) const
+    { return _i == other._i; }
+
+    bool operator!= (const const_iterator &other) const
+    { return _i != other._i; }
+
+  private:
+
+    friend class vectormultimap<Key, Tp>;
+
+    // Iterates from \p i over the sorted part, then over the tail
+    const_iterator (const vectormultimap<Key, Tp> *m,
+                    const std::size_t i) :
+      _map(m), _i(i), _sorted_end(m->_n_sorted), _keyed(false)
+    {
+      this->skip();
+    }
+
+    // Iterates from \p i to \p sorted_end, then over the entries
+    // of the tail with key \p key
+    const_iterator (const vectormultimap<Key, Tp> *m,
+                    const std::size_t i,
+                    const std::size_t sorted_end,
+                    const Key &key) :
+      _map(m), _i(i), _sorted_end(sorted_end), _key(key), _keyed(true)
+    {
+      this->skip();
+    }
+
+    void skip ()
+    {
+      const std::size_t n_sorted = _map->_n_sorted;
+      const std::size_t n = _map->_vals.size();
+
+      for (;;)
+        {
+          if (_i == _sorted_end && _i < n_sorted)
+            _i = n_sorted;
+
+          if (_i == n)
+            return;
+
+          if ((_map->_n_erased && _map->_erased[_i]) ||
+              (_keyed && _i >= n_sorted &&
+               !_map->same_key(_map->_vals[_i].first, _key)))
+            ++_i;
+          else
+            return;
+        }
+    }
+
+    const vectormultimap<Key, Tp> *_map;
+    std::size_t _i;
+
+    // The end of the part of the sorted entries being visited
+    std::size_t _sorted_end;
+
+    // The key of the tail entries being visited, if \p _keyed
+    Key _key;
+    bool _keyed;
+  };
+
+  /**
+   * Default constructor.
+   */
+  vectormultimap () :
+    _sorted(true),
+    _n_sorted(0),
+    _n_erased(0)
+  {}
+
+  /**
+   * Copy constructor.
+   */
+  vectormultimap (const vectormultimap<Key, Tp> &other) :
+    _sorted(true),
+    _n_sorted(0),
+    _n_erased(0)
+  {
+    *this = other;
+  }
+
+  /**
+   * Assignment operator.  The copy is sorted.
+   */
+  vectormultimap<Key, Tp> & operator= (const vectormultimap<Key, Tp> &other)
+  {
+    if (this != &other)
+      {
+        _vals = other._vals;
+        _erased = other._erased;
+        _n_sorted = other._n_sorted;
+        _n_erased = other._n_erased;
+        _sorted = other._sorted;
+        if (!_sorted || _n_erased)
+          this->merge();
+      }
+    return *this;
+  }
+
+  /**
+   * Inserts \p x, unless it is already stored.  This may merge the
+   * unsorted tail, which invalidates iterators.
+   */
+  void insert (const value_type &x)
+  {
+    const std::pair<std::size_t, std::size_t> range =
+      this->sorted_range(x.first);
+
+    // x may reuse a slot an erased entry with the same key left
+    std::size_t free_slot = _vals.size();
+    for (std::size_t i = range.first; i != range.second; ++i)
+      if (_erased[i])
+        {
+          if (free_slot == _vals.size())
+            free_slot = i;
+        }
+      else if (_vals[i].second == x.second)
+        return;
+
+    for (std::size_t i = _n_sorted; i != _vals.size(); ++i)
+      if (!_erased[i] && this->same_key(_vals[i].first, x.first) &&
+          _vals[i].second == x.second)
+        return;
+
+    if (free_slot != _vals.size())
+      {
+        _vals[free_slot] = x;
+        _erased[free_slot] = false;
+        --_n_erased;
+        return;
+      }
+
+    // With no unsorted tail, x can go at the end if no stored key is
+    // greater
+    if (_n_sorted == _vals.size() && range.second == _vals.size())
+      {
+        _vals.push_back(x);
+        _erased.push_back(false);
+        ++_n_sorted;
+        return;
+      }
+
+    _vals.push_back(x);
+    _erased.push_back(false);
+    _sorted = false;
+
+    // Keep the tail short enough for lookups to scan
+    const std::size_t n_tail = _vals.size() - _n_sorted;
+    if (n_tail > 16 && n_tail*n_tail > _vals.size())
+      this->merge();
+  }
+
+  /**
+   * Inserts the pairs in [\p first, \p last) which are not already
+   * stored, with a single merge, which invalidates iterators.
+   */
+  template <typename InputIterator>
+  void insert (InputIterator first, InputIterator last)
+  {
+    for (; first != last; ++first)
+      {
+        _vals.push_back(*first);
+        _erased.push_back(false);
+      }
+
+    if (_n_sorted != _vals.size())
+      {
+        _sorted = false;
+        this->merge();
+      }
+  }
+
+  /**
+   * Erases all the entries with key \p key.  Once erased entries
+   * make up half of the vector their slots are freed, which
+   * invalidates iterators.
+   */
+  void erase (const key_type &key)
+  {
+    const std::pair<std::size_t, std::size_t> range =
+      this->sorted_range(key);
+
+    for (std::size_t i = range.first; i != range.second; ++i)
+      this->erase_index(i);
+
+    for (std::size_t i = _n_sorted; i != _vals.size(); ++i)
+      if (this->same_key(_vals[i].first, key))
+        this->erase_index(i);
+
+    if (2*_n_erased > _vals.size())
+      this->merge();
+  }
+
+  /**
+   * Erases the entry at \p it.  Other iterators, including those in
+   * the middle of the same range, stay valid; the slot is freed by a
+   * later merge.
+   */
+  void erase (const const_iterator &it)
+  {
+    libmesh_assert_equal_to (it._map, this);
+    this->erase_index(it._i);
+  }
+
+  /**
+   * Erases everything.
+   */
+  void clear ()
+  {
+    _vals.clear();
+    _erased.clear();
+    _n_sorted = 0;
+    _n_erased = 0;
+    _sorted = true;
+  }
+
+  /**
+   * Merges in any out-of-order insertions, so that lookups are
+   * plain binary searches and iteration is in key order.  The slots
+   * of erased entries are freed too, once they make up half of the
+   * vector.  This invalidates iterators, and is cheap when there is
+   * nothing to do.
+   */
+  void sort ()
+  {
+    if (!_sorted || 2*_n_erased > _vals.size())
+      this->merge();
+  }
+
+  /**
+   * @returns true if there are no out-of-order insertions in the
+   * unsorted tail.
+   */
+  bool sorted () const
+  { return _sorted; }
+
+  /**
+   * @returns an iterator to the first entry.
+   */
+  const_iterator begin () const
+  {
+    return const_iterator(this, 0);
+  }
+
+  /**
+   * @returns an iterator past the last entry.
+   */
+  const_iterator end () const
+  {
+    return const_iterator(this, _vals.size());
+  }
+
+  /**
+   * @returns the range of entries with key \p key, in the order
+   * they were inserted.
+   */
+  std::pair<const_iterator, const_iterator>
+  equal_range (const key_type &key) const
+  {
+    const std::pair<std::size_t, std::size_t> range =
+      this->sorted_range(key);
+
+    return std::make_pair(const_iterator(this, range.first, range.second, key),
+                          const_iterator(this, _vals.size()));
+  }
+
+  /**
+   * @returns the number of entries with key \p key.
+   */
+  std::size_t count (const key_type &key) const
+  {
+    std::pair<const_iterator, const_iterator> range =
+      this->equal_range(key);
+    return std::distance(range.first, range.second);
+  }
+
+  /**
+   * @returns the number of entries.
+   */
+  std::size_t size () const
+  {
+    return _vals.size() - _n_erased;
+  }
+
+  /**
+   * @returns true if there are no entries.
+   */
+  bool empty () const
+  { return this->size() == 0; }
+
+private:
+
+  /**
+   * @returns the index range of key \p key in the sorted part,
+   * including erased entries.
+   */
+  std::pair<std::size_t, std::size_t>
+  sorted_range (const key_type &key) const
+  {
+    const typename vector_type::const_iterator
+      first = _vals.begin(),
+      last  = first + _n_sorted;
+
+    const typename vector_type::const_iterator
+      lower = std::lower_bound (first, last, value_type(key, Tp()), KeyOrder()),
+      upper = std::upper_bound (lower, last, value_type(key, Tp()), KeyOrder());
+
+    return std::make_pair(static_cast<std::size_t>(lower - first),
+                          static_cast<std::size_t>(upper - first));
+  }
+
+  /**
+   * @returns true if neither key orders before the other.
+   */
+  static bool same_key (const key_type &a, const key_type &b)
+  {
+    return !std::less<Key>()(a, b) && !std::less<Key>()(b, a);
+  }
+
+  /**
+   * Flags entry \p i erased.  Its slot is freed by the next merge, or
+   * reused by an insertion with the same key.
+   */
+  void erase_index (const std::size_t i)
+  {
+    if (!_erased[i])
+      {
+        _erased[i] = true;
+        ++_n_erased;
+      }
+  }
+
+  /**
+   * Removes erased entries, then sorts the unsorted tail and merges
+   * it into the sorted part, dropping repeated (key, value) pairs.
+   */
+  void merge ()
+  {
+    // Compact, keeping track of where the sorted part ends
+    std::size_t n_sorted = 0, n = 0;
+    for (std::size_t i = 0; i != _vals.size(); ++i)
+      {
+        if (i == _n_sorted)
+          n_sorted = n;
+        if (!_erased[i])
+          _vals[n++] = _vals[i];
+      }
+    if (_n_sorted == _vals.size())
+      n_sorted = n;
+    _vals.resize(n);
+
+    // Merge the tail.  Both the sort and the merge are stable, so
+    // values for the same key stay in insertion order.
+    KeyOrder order;
+    std::stable_sort (_vals.begin() + n_sorted, _vals.end(), order);
+    std::inplace_merge (_vals.begin(), _vals.begin() + n_sorted,
+                        _vals.end(), order);
+
+    // Drop any repeated pairs; only those for the same key can be
+    // equal, and there are few of those.
+    std::size_t out = 0, key_begin = 0;
+    for (std::size_t i = 0; i != _vals.size(); ++i)
+      {
+        if (out && order(_vals[out-1], _vals[i]))
+          key_begin = out;
+
+        bool repeated = false;
+        for (std::size_t j = key_begin; j != out; ++j)
+          if (_vals[j].second == _vals[i].second)
+            {
+              repeated = true;
+              break;
+            }
+
+        if (!repeated)
+          _vals[out++] = _vals[i];
+      }
+    _vals.resize(out);
+
+    // Release the memory of a large unsorted tail or of many erased
+    // entries
+    if (_vals.capacity() > 2*_vals.size())
+      vector_type(_vals).swap(_vals);
+
+    _erased.assign(_vals.size(), false);
+    _n_sorted = _vals.size();
+    _n_erased = 0;
+    _sorted = true;
+  }
+
+  /**
+   * Strict weak ordering, based solely on the key.
+   */
+  struct KeyOrder
+  {
+    bool operator() (const value_type &lhs,
+                     const value_type &rhs) const
+    { return std::less<Key>()(lhs.first, rhs.first); }
+  };
+
+  /**
+   * The entries.  The first \p _n_sorted are sorted by key.
+   */
+  vector_type _vals;
+
+  /**
+   * Flags for the entries which have been erased.
+   */
+  std::vector<bool> _erased;
+
+  /**
+   * True when there is no unsorted tail to merge in.
+   */
+  bool _sorted;
+
+  /**
+   * The length of the sorted part of \p _vals.
+   */
+  std::size_t _n_sorted;
+
+  /**
+   * The number of erased entries still in \p _vals.
+   */
+  std::size_t _n_erased;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_VECTORMULTIMAP_H
@@ -653,6 +653,24 @@ fi
 
 
 
+# -------------------------------------------------------------
+# Slab allocation of Elem and Node objects -- disabled by default
+# -------------------------------------------------------------
+AC_ARG_ENABLE(slab-allocator,
+              AS_HELP_STRING([--enable-slab-allocator],
+                             [allocate Elem and Node objects from slabs rather than individually with operator new]),
+              enableslaballocator=$enableval,
+              enableslaballocator=no)
+
+if test "$enableslaballocator" != no ; then
+  AC_DEFINE(ENABLE_SLAB_ALLOCATOR, 1,
+           [Flag indicating if Elem and Node objects should be allocated from slabs])
+  AC_MSG_RESULT(<<< Configuring library with slab allocation of elements and nodes >>>)
+fi
+# -------------------------------------------------------------
+
+
+
 # -------------------------------------------------------------
 # Performance Logging -- disabled by default
 # -------------------------------------------------------------